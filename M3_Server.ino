@@ -1,5 +1,5 @@
 #include <Arduino.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 
 #include "config.h"
 #include "app_state.h"
@@ -14,11 +14,8 @@
 #include "debug_console.h"
 
 
-// globaler Zustand
-AppState g_state;
-
-// Webserver-Instanz
-WebServer server(80);
+// Webserver-Instanz (asynchron, eigene Task; loop() holt nur Befehle ab)
+AsyncWebServer server(80);
 
 void setup() {
   Serial.begin(SERIAL_BAUD);
@@ -40,7 +37,7 @@ void setup() {
 }
 
 void loop() {
-  webui_loop(server);
+  webui_loop();
   radio_loop();
   dbg_loop();
 
@@ -50,7 +47,7 @@ void loop() {
    ui_handleEncoder(ev);
 
   // ---------- Display ----------
-  // Zeichnet nur, wenn dirty
-  displayTick();
+  // Zeichnet nur, wenn dirty (plus seltener Voll-Refresh)
+  displayTickPeriodic();
 
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+#include "config.h"     // RadioState, RadioMode
+#include "encoder.h"    // EncButtonEvent
+#include "event_bus.h"
+
+// Events zwischen den Modulen und wer sie bekommt.
+//
+// Zustands-Events sendet app_state.cpp nach einer echten Änderung (der
+// Wert steht dann schon im Store, ein Snapshot im Handler sieht ihn).
+// InputEvent sendet ui.cpp für jedes Encoder-Event mit Drehung/Taste.
+// Neue Empfänger: Klasse hier deklarieren, Handler im eigenen .cpp
+// definieren, in APP_BUS_SUBSCRIBERS eintragen – Sender bleiben unverändert.
+
+struct FrequencyChanged {
+  uint32_t hz;          // Wunsch (angezeigt)
+  uint32_t radio_hz;    // zuletzt vom Radio bestätigt/gemeldet, 0 = unbekannt
+  bool confirmed;       // Radio hat genau den aktuellen Wunsch bestätigt
+  uint16_t seq;         // AppState::freq_seq des Wunschs
+  uint32_t version;     // app_state_version() nach der Änderung
+};
+
+struct ModeChanged {
+  RadioMode mode;       // vom Radio bestätigt
+  RadioMode desired;    // zuletzt angefordert
+  uint32_t version;
+};
+
+struct LinkStateChanged {
+  RadioState link;
+  bool connected;
+  bool busy;            // Radio-TX-Queue voll gelaufen
+  uint32_t version;
+};
+
+struct PresetChanged {
+  uint8_t page;         // 0 = "Plain"
+  uint32_t version;
+};
+
+struct InputEvent {
+  int8_t steps;
+  int32_t accel_steps;
+  uint16_t velocity;       // Rastungen/s
+  EncButtonEvent button;
+  uint8_t link_load_pct;   // Füllstand der Radio-Queue (für das Frame-Pacing)
+  uint32_t t_ms;
+};
+
+// ---------- Empfänger (Handler in display_sh1107.cpp / ui.cpp / web_ui.cpp / debug_console.cpp / latency_trace.cpp) ----------
+struct DisplayEvents {
+  static void on(const FrequencyChanged& e);
+  static void on(const ModeChanged& e);
+  static void on(const LinkStateChanged& e);
+  static void on(const InputEvent& e);
+};
+
+// Offene UI-Aktionen (Mode, REMOTE an/aus) über ACK bzw. Timeout abschließen
+struct UiEvents {
+  static void on(const ModeChanged& e);
+  static void on(const LinkStateChanged& e);
+};
+
+struct WebEvents {
+  static void on(const FrequencyChanged& e);
+  static void on(const ModeChanged& e);
+  static void on(const LinkStateChanged& e);
+  static void on(const PresetChanged& e);
+};
+
+struct ConsoleEvents {
+  static void on(const FrequencyChanged& e);
+  static void on(const ModeChanged& e);
+  static void on(const LinkStateChanged& e);
+  static void on(const PresetChanged& e);
+  static void on(const InputEvent& e);
+};
+
+// Neue Wunschfrequenz während einer Eingabe -> Latenz-Trace öffnen
+struct LatencyEvents {
+  static void on(const FrequencyChanged& e);
+};
+
+// Host-Tools linken nur einen Teil der Module und setzen die Liste per -D
+// (z.B. -DAPP_BUS_SUBSCRIBERS=DisplayEvents).
+#ifndef APP_BUS_SUBSCRIBERS
+#define APP_BUS_SUBSCRIBERS DisplayEvents, UiEvents, WebEvents, ConsoleEvents, LatencyEvents
+#endif
+
+typedef EventBus<APP_BUS_SUBSCRIBERS> AppBus;
@@ -0,0 +1,159 @@
+#include "app_state.h"
+#include "app_events.h"
+
+static AppState state;
+static uint32_t version = 0;
+static uint32_t fieldVersion[(uint8_t)StateField::COUNT];
+
+// Seqlock: ungerade = Schreiben läuft. Schreiber untereinander serialisiert
+// der Spinlock (nur für die paar Stores, Interrupts auf diesem Core aus),
+// Leser nehmen ihn nie.
+static volatile uint32_t seq = 0;
+static portMUX_TYPE writeMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t snapshotRetries = 0;
+
+const AppState& app_state() {
+  return state;
+}
+
+uint32_t app_state_snapshot(AppState& out) {
+  for (;;) {
+    uint32_t s0 = seq;
+    __sync_synchronize();
+    if (!(s0 & 1)) {
+      out = state;
+      uint32_t v = version;
+      __sync_synchronize();
+      if (seq == s0) return v;
+    }
+    snapshotRetries++;
+  }
+}
+
+uint32_t app_state_snapshot_retries() {
+  return snapshotRetries;
+}
+
+uint32_t app_state_version() {
+  return version;
+}
+
+uint32_t app_state_version(StateField f) {
+  return fieldVersion[(uint8_t)f];
+}
+
+// Ein Schreiben unter dem Seqlock: change(state) ändert und liefert, ob
+// sich etwas geändert hat. Rückgabe: neue Version, 0 = nichts geändert
+// (keine Version, kein Event). snap bekommt den Stand direkt nach dem
+// eigenen Schreiben; Events werden daraus außerhalb des Spinlocks gebaut.
+template <typename Change>
+static uint32_t writeState(StateField f, AppState& snap, Change change) {
+  uint32_t nv = 0;
+  portENTER_CRITICAL(&writeMux);
+  seq = seq + 1;
+  __sync_synchronize();
+  if (change(state)) {
+    fieldVersion[(uint8_t)f]++;
+    nv = ++version;
+  }
+  __sync_synchronize();
+  seq = seq + 1;
+  snap = state;
+  portEXIT_CRITICAL(&writeMux);
+  return nv;
+}
+
+template <typename T>
+static uint32_t setField(T AppState::*field, T v, StateField f, AppState& snap) {
+  if (state.*field == v) return 0;   // häufigster Fall, ohne Lock
+  return writeState(f, snap, [&](AppState& s) {
+    if (s.*field == v) return false;
+    s.*field = v;
+    return true;
+  });
+}
+
+static void publishFreq(const AppState& s, uint32_t v) {
+  if (v) AppBus::publish(FrequencyChanged{ s.freq_hz, s.freq_radio_hz, app_state_freq_confirmed(s), s.freq_seq, v });
+}
+
+static void publishLink(const AppState& s, uint32_t v) {
+  if (v) AppBus::publish(LinkStateChanged{ s.link, s.connected, s.busy, v });
+}
+
+static void publishMode(const AppState& s, uint32_t v) {
+  if (v) AppBus::publish(ModeChanged{ s.mode, s.desired_mode, v });
+}
+
+void app_state_set_link(RadioState v) {
+  AppState s;
+  publishLink(s, setField(&AppState::link, v, StateField::Link, s));
+}
+
+void app_state_set_connected(bool v) {
+  AppState s;
+  publishLink(s, setField(&AppState::connected, v, StateField::Connected, s));
+}
+
+void app_state_set_busy(bool v) {
+  AppState s;
+  publishLink(s, setField(&AppState::busy, v, StateField::Busy, s));
+}
+
+void app_state_set_mode(RadioMode v) {
+  AppState s;
+  publishMode(s, setField(&AppState::mode, v, StateField::Mode, s));
+}
+
+void app_state_set_desired_mode(RadioMode v) {
+  AppState s;
+  publishMode(s, setField(&AppState::desired_mode, v, StateField::DesiredMode, s));
+}
+
+// Neuer Wunsch: neue freq_seq. Entspricht er schon dem, was das Radio
+// gemeldet hat (z.B. zurückgedreht), gilt er sofort als bestätigt.
+void app_state_set_freq(uint32_t hz) {
+  AppState s;
+  publishFreq(s, writeState(StateField::Freq, s, [hz](AppState& a) {
+    if (a.freq_hz == hz) return false;
+    a.freq_hz = hz;
+    a.freq_seq++;
+    if (a.freq_radio_hz == hz) a.freq_confirmed_seq = a.freq_seq;
+    return true;
+  }));
+}
+
+void app_state_confirm_freq(uint32_t hz) {
+  AppState s;
+  publishFreq(s, writeState(StateField::FreqRadio, s, [hz](AppState& a) {
+    bool confirms = a.freq_hz == hz && a.freq_confirmed_seq != a.freq_seq;
+    if (a.freq_radio_hz == hz && !confirms) return false;
+    a.freq_radio_hz = hz;
+    if (confirms) a.freq_confirmed_seq = a.freq_seq;
+    return true;
+  }));
+}
+
+void app_state_set_preset(uint8_t page) {
+  AppState s;
+  uint32_t v = setField(&AppState::preset, page, StateField::Preset, s);
+  if (v) AppBus::publish(PresetChanged{ s.preset, v });
+}
+
+const char* app_state_field_name(StateField f) {
+  switch (f) {
+    case StateField::Link:        return "link";
+    case StateField::Connected:   return "connected";
+    case StateField::Mode:        return "mode";
+    case StateField::DesiredMode: return "desired_mode";
+    case StateField::Freq:        return "freq_hz";
+    case StateField::FreqRadio:   return "freq_radio_hz";
+    case StateField::Preset:      return "preset";
+    case StateField::Busy:        return "busy";
+    default:                      return "?";
+  }
+}
+
+String app_state_preset_name(uint8_t page) {
+  return page ? String(page) : String("Plain");
+}
@@ -1,11 +1,66 @@
 #pragma once
 #include <Arduino.h>
+#include "config.h"   // RadioState, RadioMode
+
+// Zentraler Zustand von Radio und Bedienung – die einzige Kopie.
+//
+// Geschrieben wird nur über die app_state_set_*()-Funktionen. Jedes Feld hat
+// einen Versionszähler, der nur bei einer echten Änderung weiterzählt; danach
+// geht das passende Event über AppBus (app_events.h) an die Empfänger.
+//
+// Lesen: app_state_snapshot() liefert eine in sich stimmige Kopie (Seqlock),
+// auch wenn Schreiber in einer anderen Task oder auf dem anderen Core laufen.
+// Schreiber warten nie auf Leser; Leser wiederholen die Kopie, falls sie in
+// ein Schreiben fallen. app_state() ist der direkte Zugriff für Code, der im
+// selben Kontext wie die Schreiber läuft (loop(): radio_link, ui).
+
+enum class StateField : uint8_t {
+  Link,          // Handshake-Zustand (RadioState)
+  Connected,     // REMOTE aktiv
+  Mode,          // vom Radio bestätigter Mode
+  DesiredMode,   // zuletzt angeforderter Mode
+  Freq,          // gewünschte Frequenz (+ freq_seq)
+  FreqRadio,     // vom Radio bestätigte/gemeldete Frequenz
+  Preset,
+  Busy,          // Radio-TX-Queue voll gelaufen
+  COUNT
+};
 
 struct AppState {
-  bool radio_connected = false;
+  RadioState link = RadioState::BOOT;
+  bool connected = false;
+  RadioMode mode = RadioMode::UNKNOWN;
+  RadioMode desired_mode = RadioMode::UNKNOWN;
+  // Frequenz: freq_hz ist der Wunsch (UI/Web, sofort angezeigt),
+  // freq_radio_hz das, was das Radio zuletzt bestätigt oder gemeldet hat.
+  // freq_seq zählt jeden neuen Wunsch; bestätigt ist er, wenn das Radio
+  // genau diesen Wert gemeldet hat (freq_confirmed_seq == freq_seq).
   uint32_t freq_hz = 14074000;
-  String mode = "USB";
-  String preset = "Plain";   // "Plain" oder "1".."9"
+  uint32_t freq_radio_hz = 0;        // 0 = noch nichts vom Radio
+  uint16_t freq_seq = 0;
+  uint16_t freq_confirmed_seq = 0;
+  uint8_t preset = 0;        // 0 = "Plain", 1..9
+  bool busy = false;
 };
 
-// extern AppState g_state;
\ No newline at end of file
+inline bool app_state_freq_confirmed(const AppState& s) {
+  return s.freq_confirmed_seq == s.freq_seq;
+}
+
+const AppState& app_state();
+uint32_t app_state_snapshot(AppState& out);    // Rückgabe: Version der Kopie
+uint32_t app_state_version();                  // zählt bei jeder Änderung
+uint32_t app_state_version(StateField f);
+uint32_t app_state_snapshot_retries();         // Kopien, die ein Schreiben überlappt haben
+
+void app_state_set_link(RadioState v);
+void app_state_set_connected(bool v);
+void app_state_set_mode(RadioMode v);
+void app_state_set_desired_mode(RadioMode v);
+void app_state_set_freq(uint32_t hz);           // neuer Wunsch
+void app_state_confirm_freq(uint32_t hz);       // Radio hat hz bestätigt/gemeldet
+void app_state_set_preset(uint8_t page);
+void app_state_set_busy(bool v);
+
+const char* app_state_field_name(StateField f);
+String app_state_preset_name(uint8_t page);    // 0 -> "Plain"
@@ -1,8 +1,6 @@
 #include "config.h"
 // #include <string>
 
-GlobalRadioState global_radio_state;
-
 String radio_mode_to_string(RadioMode mode)
 {
     switch (mode) {
@@ -22,6 +22,35 @@ static const int RADIO_TX_PIN = 17;     // anpassen
 static const uint32_t RADIO_BAUD = 19200; // anpassen
 static const uint32_t RADIO_TX_GAP_MS = 30; // Mindestabstand zwischen Commands
 
+// Telemetrie (S-Meter, TX-Leistung, SWR) – nur in freier Link-Kapazität abfragen
+static const bool RADIO_TELEMETRY_ENABLED = true;
+static const uint32_t RADIO_TELEMETRY_PERIOD_MS = 1000;       // pro Kanal
+static const uint32_t RADIO_TELEMETRY_REPLY_TIMEOUT_MS = 300;  // danach nächster Kanal
+static const uint16_t RADIO_TELEMETRY_HTTP_MAX = 64;           // Samples pro /api/telemetry
+
+// Link-Überwachung: Verlust spätestens nach IDLE + TIMEOUT ohne RX erkannt
+static const uint32_t RADIO_KEEPALIVE_IDLE_MS = 2000;     // so lange ohne RX -> Keepalive-Abfrage
+static const uint32_t RADIO_KEEPALIVE_TIMEOUT_MS = 1000;  // ohne Antwort -> Radio verloren
+static const uint32_t RADIO_REOPEN_INTERVAL_MS = 1000;    // OPEN wiederholen bis "o" kommt
+
+// Mode / REMOTE an/aus warten nicht blockierend auf das ACK
+static const uint32_t RADIO_ACK_TIMEOUT_MS = 1500;   // ohne ACK -> Befehl gescheitert, zurück
+static const uint32_t RADIO_MODE_SETTLE_MS = 500;    // ohne ACK im Protokoll: so lange nach Mode nichts senden
+
+// Frequenz: Wunsch gegen Radio abgleichen (AppState::freq_hz / freq_radio_hz)
+static const uint32_t RADIO_FREQ_CONFIRM_MS = 300;   // ohne Bestätigung -> nachfragen, dann neu senden
+static const uint8_t RADIO_FREQ_RETRIES = 2;         // danach gilt, was das Radio meldet
+
+// Web (ESPAsyncWebServer): Handler laufen in der AsyncTCP-Task, Befehle
+// gehen über eine Mailbox an loop(). Live-Status per WebSocket /ws,
+// /api/state-Polling nur noch als Fallback.
+static const uint16_t WEB_BODY_MAX = 256;            // POST-Body, größer -> 413
+static const uint8_t WEB_CMD_MAX = 96;               // ein Befehl (JSON) in der Mailbox
+static const uint8_t WEB_CMD_QUEUE_LEN = 8;          // Mailbox voll -> 429
+static const uint8_t WEB_WS_MAX_CLIENTS = 4;
+static const uint32_t WEB_WS_PUSH_MIN_MS = 50;       // Änderungen bündeln (max. 20 Pushes/s)
+static const uint32_t WEB_WS_PING_MS = 15000;        // Ping + tote Clients aufräumen
+
 static const bool RADIO_DEBUG_MIRROR = true; 
 static const bool RADIO_STATE_MIRROR = true;
 
@@ -46,46 +75,13 @@ static constexpr uint32_t FREQ_MIN_HZ =     1500UL; //  1,5 kHz
 static constexpr uint32_t FREQ_MAX_HZ = 30000000UL; // 30 MHz
 static constexpr uint32_t FREQ_TX_MIN_HZ = 1500000; // 1,5 MHz
 
-//--------------------------------------------------
-// Global Radio State
-//--------------------------------------------------
-
-struct GlobalRadioState {
-  RadioState state = RadioState::BOOT;
-  RadioMode mode = RadioMode::UNKNOWN;
-  RadioMode desired_mode = RadioMode::UNKNOWN;
-  String mode_str = "USB";
-
-  uint32_t freq_hz = 1500;
-  bool radio_connected = false;
-  
-  String preset = "Plain";   // "Plain" oder "1".."9"
-
-  bool tuneMarker = false;  
-  uint8_t tuneCursor = 2; // default 1 KHZ
-  bool tuneSelect = false;
-  
-  static constexpr uint8_t MENU_MAX = 4;
-  const char* menu[MENU_MAX] = {"Freq", "Mode", "Preset", "Conn"};
-  uint8_t menu_count = 4;
-  uint8_t menu_index = 0;
-};
-
-extern GlobalRadioState global_radio_state;
+// Zustand (Frequenz, Mode, Verbindung, …): app_state.h
 
 
 // -------------------------------------------------
-// Radio protocol framing
+// Radio protocol (radio_codec.h)
 // -------------------------------------------------
 
-// Prefix vor JEDEM Radiobefehl
-static const char* RADIO_HEADER = "\nDM:";
-
-// Optionales Suffix (meist CRLF)
-static const char* RADIO_FOOTER = "\r";
-
-// Trenner zwischen Befehl und Parameter(n)
-static const char* RADIO_DELIMITER = " ";
-
-// Trenner zwischen mehreren Befehlen im selben Frame
-static const char  RADIO_CMD_SEPARATOR = ';';
+// DmCodec (DM-Textprotokoll), CatCodec (Kenwood-CAT) oder CivCodec (Icom CI-V).
+// Zur Compile-Zeit gewählt, Framing und Antwortformat stecken im Codec.
+#define RADIO_CODEC DmCodec
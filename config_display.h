@@ -8,6 +8,11 @@ static constexpr uint8_t OLED_SCL = 22;
 // I2C Adresse (meist 0x3C, manchmal 0x3D)
 static constexpr uint8_t OLED_ADDR = 0x3C;
 
+// I2C-Takt. Das SH1107-Datenblatt nennt 400 kHz, die üblichen Module laufen
+// auch mit 1 MHz. Ohne ACK fällt displayInit() auf 400/100 kHz zurück;
+// bei Bildfehlern ohne Busfehler hier senken.
+static constexpr uint32_t OLED_I2C_HZ = 1000000;
+
 // Display
 static constexpr int OLED_W = 128;
 static constexpr int OLED_H = 128;
@@ -21,3 +26,22 @@ static constexpr int UI_FOOTER_H = 24;
 // Refresh-Limit (optional)
 static constexpr uint32_t UI_MIN_REFRESH_MS = 50;
 
+// Frame-Pacing beim schnellen Drehen: Zwischenwerte zusammenfassen, der
+// Endwert kommt spätestens UI_PACE_SETTLE_MS nach der letzten Raste.
+static constexpr uint16_t UI_PACE_VELOCITY_MIN = 8;    // Rasten/s, darunter volle Rate
+static constexpr uint32_t UI_PACE_MS_PER_DETENT = 4;   // +ms Frameabstand je Raste/s darüber
+static constexpr uint32_t UI_PACE_MAX_MS = 200;        // längster Frameabstand beim Drehen
+static constexpr uint32_t UI_PACE_SETTLE_MS = 60;      // so lange ohne Raste = Drehen vorbei
+static constexpr uint8_t  UI_PACE_LINK_LOAD_PCT = 50;  // Radio-Queue voller: Abstand verdoppeln
+
+// Ohne Änderung spätestens nach dieser Zeit alles neu übertragen
+// (fängt Störungen am Panel ab; ein voller Frame sind ~2.2 KB I2C)
+static constexpr uint32_t UI_MAX_STALE_MS = 10000;
+
+// Flush über eigene Task: loop() rendert nur, die Task schiebt per I2C raus.
+// Core 0 teilt sich die Task mit WiFi, loop() läuft auf Core 1.
+static constexpr bool     DISPLAY_ASYNC_FLUSH = true;
+static constexpr int      DISPLAY_FLUSH_CORE = 0;
+static constexpr uint8_t  DISPLAY_FLUSH_PRIO = 1;
+static constexpr uint32_t DISPLAY_FLUSH_STACK = 3072;
+
@@ -1,19 +1,111 @@
 #include "config.h"
 
 #include "app_state.h"
+#include "app_events.h"
 #include "wifi_manager.h"
 #include "wifi_config.h"
 #include "radio_link.h"
+#include "radio_codec.h"   // RADIO_RAW_CORE_MAX
 #include "encoder_config.h"
+#include "encoder.h"
+#include "display.h"
+#include "telemetry.h"
+#include "latency_trace.h"
 
 static String lineBuf;
+static bool watchState = false;   // "watch on": AppBus-Events ausgeben
+static bool watchInput = false;   // "watch input": zusätzlich Encoder-Events
 
+// AppBus-Handler: Event mit neuem Wert und Version
+void ConsoleEvents::on(const FrequencyChanged& e) {
+  if (!watchState) return;
+  Serial.print("[watch] freq_hz=");
+  Serial.print((unsigned long)e.hz);
+  Serial.print(" radio=");
+  Serial.print((unsigned long)e.radio_hz);
+  Serial.print(e.confirmed ? " confirmed" : " unconfirmed");
+  Serial.print(" v");
+  Serial.println(e.version);
+}
+
+void ConsoleEvents::on(const ModeChanged& e) {
+  if (!watchState) return;
+  Serial.print("[watch] mode=");
+  Serial.print(radio_mode_to_string(e.mode));
+  Serial.print(" desired=");
+  Serial.print(radio_mode_to_string(e.desired));
+  Serial.print(" v");
+  Serial.println(e.version);
+}
+
+void ConsoleEvents::on(const LinkStateChanged& e) {
+  if (!watchState) return;
+  Serial.print("[watch] link=");
+  Serial.print(radio_state_to_string(e.link));
+  Serial.print(" connected=");
+  Serial.print(e.connected ? "true" : "false");
+  Serial.print(" busy=");
+  Serial.print(e.busy ? "true" : "false");
+  Serial.print(" v");
+  Serial.println(e.version);
+}
+
+void ConsoleEvents::on(const PresetChanged& e) {
+  if (!watchState) return;
+  Serial.print("[watch] preset=");
+  Serial.print(app_state_preset_name(e.page));
+  Serial.print(" v");
+  Serial.println(e.version);
+}
+
+void ConsoleEvents::on(const InputEvent& e) {
+  if (!watchInput) return;
+  Serial.print("[watch] input t=");
+  Serial.print(e.t_ms);
+  Serial.print(" steps=");
+  Serial.print(e.steps);
+  Serial.print(" accel=");
+  Serial.print(e.accel_steps);
+  Serial.print(" vel=");
+  Serial.print(e.velocity);
+  Serial.print(" btn=");
+  Serial.print(e.button == EncButtonEvent::Click ? "click" :
+               e.button == EncButtonEvent::LongPress ? "long" : "-");
+  Serial.print(" load=");
+  Serial.print(e.link_load_pct);
+  Serial.println("%");
+}
 
 
 static void printPrompt() {
   Serial.print("> ");
 }
 
+// Annahme durch die Radio-Queue ausgeben: "OK <what> (queued)" oder "BUSY ..."
+static void printAdmit(const char* what, RadioAdmit a) {
+  if (radio_admit_ok(a)) {
+    Serial.print("OK ");
+    Serial.print(what);
+    Serial.print(" (");
+    Serial.print(radio_admit_to_string(a));
+    Serial.println(")");
+    return;
+  }
+  Serial.print(a == RadioAdmit::QUEUE_FULL ? "BUSY " : "FAIL ");
+  Serial.print(what);
+  Serial.print(": ");
+  Serial.print(radio_admit_to_string(a));
+  Serial.print(" depth=");
+  Serial.print(radio_queue_depth());
+  Serial.print("/");
+  Serial.print(radio_queue_capacity());
+  if (a == RadioAdmit::QUEUE_FULL) {
+    Serial.print(" retry_ms=");
+    Serial.print(radio_retry_after_ms());
+  }
+  Serial.println();
+}
+
 static void cmd_help() {
   Serial.println("Commands:");
   Serial.println("  help");
@@ -24,15 +116,42 @@ static void cmd_help() {
   Serial.println("  get_preset");
   Serial.println("  get_connected");
   Serial.println("  get_radio_state");
+  Serial.println("  get_link");
   Serial.println("  connect or disconnect");
-  Serial.println("  radio_raw <command>");
+  Serial.println("  radio_raw <command>   (max. " + String(RADIO_RAW_CORE_MAX) + " Zeichen)");
   Serial.println("  radio_get_rxfreq");
   Serial.println("  radio_get_preset");
+  Serial.println("  get_telemetry");
+  Serial.println("  telemetry on|off|<period ms>");
   Serial.println(". get_button_state");
+  Serial.println("  get_encoder");
+  Serial.println("  get_display | display_refresh | display_reset | display_bench");
+  Serial.println("  get_state | watch on|input|off");
+  Serial.println("  get_latency | latency_reset");
   Serial.println("  reboot");
   Serial.println();
 }
 
+// p50/p95/p99 (Bucket-Obergrenzen) und die belegten Buckets als <obergrenze>:<anzahl>
+template <uint8_t N>
+static void printHistogram(const char* name, const Log2Histogram<N>& h) {
+  Serial.print(name);
+  Serial.print(": n=");   Serial.print(h.total());
+  Serial.print(" p50<="); Serial.print(h.percentile(50));
+  Serial.print(" p95<="); Serial.print(h.percentile(95));
+  Serial.print(" p99<="); Serial.print(h.percentile(99));
+  Serial.print(" |");
+  for (uint8_t i = 0; i < N; i++) {
+    if (!h.count[i]) continue;
+    Serial.print(' ');
+    if (i == N - 1) Serial.print('>');
+    Serial.print(i ? (1UL << i) - 1 : 0);
+    Serial.print(':');
+    Serial.print(h.count[i]);
+  }
+  Serial.println();
+}
+
 static void handleCommand(const String& lineRaw) {
   String line = lineRaw;
   line.trim();
@@ -70,63 +189,146 @@ static void handleCommand(const String& lineRaw) {
   }
   else if (cmdLower == "get_frequency") {
     Serial.print("freq_hz=");
-    Serial.println((unsigned long)global_radio_state.freq_hz);
+    Serial.println((unsigned long)app_state().freq_hz);
   }
   else if (cmdLower == "set_frequency") {
     Serial.print("freq_hz=");
     Serial.println(args);
     long hz = args.toInt();
-    if (hz >= 0) {
-      global_radio_state.freq_hz = (uint32_t)hz;
-      radio_send_freq(global_radio_state.freq_hz);
+    if (hz > 0) {
+      printAdmit("set_frequency", radio_send_freq((uint32_t)hz));
     }
   }
   else if (cmdLower == "get_mode") {
-    Serial.print("GlobalRadioState.mode = ");
-    Serial.println(radio_mode_to_string(global_radio_state.mode));
+    Serial.print("AppState.mode = ");
+    Serial.println(radio_mode_to_string(app_state().mode));
     Serial.print("Radio.mode = ");
-    radio_query_mode();
+    printAdmit("query mode", radio_query_mode());
   }
   else if (cmdLower == "get_preset") {
     Serial.print("preset=");
-    Serial.println(global_radio_state.preset);
+    Serial.println(app_state_preset_name(app_state().preset));
   }
   else if (cmdLower == "get_connected") {
     
   }
   else if (cmdLower == "get_radio_state") {
+    AppState s;
+    app_state_snapshot(s);
     Serial.print("radio_connected=");
-    Serial.println(global_radio_state.radio_connected ? "true" : "false");
+    Serial.println(s.connected ? "true" : "false");
     Serial.print("radio_state=");
-    Serial.println(radio_state_to_string(global_radio_state.state));
+    Serial.println(radio_state_to_string(s.link));
+  }
+  else if (cmdLower == "get_state") {
+    AppState s;
+    Serial.print("version=");
+    Serial.println(app_state_snapshot(s));
+    Serial.print("freq_hz=");
+    Serial.println((unsigned long)s.freq_hz);
+    Serial.print("freq_radio_hz=");
+    Serial.println((unsigned long)s.freq_radio_hz);
+    Serial.print("freq_seq=");
+    Serial.print(s.freq_seq);
+    Serial.print(" confirmed_seq=");
+    Serial.println(s.freq_confirmed_seq);
+    Serial.print("mode=");
+    Serial.println(radio_mode_to_string(s.mode));
+    Serial.print("connected=");
+    Serial.println(s.connected ? "true" : "false");
+    Serial.print("snapshot_retries=");
+    Serial.println(app_state_snapshot_retries());
+    for (uint8_t i = 0; i < (uint8_t)StateField::COUNT; i++) {
+      Serial.print("  ");
+      Serial.print(app_state_field_name((StateField)i));
+      Serial.print(" v");
+      Serial.println(app_state_version((StateField)i));
+    }
+  }
+  else if (cmdLower == "watch") {
+    if (args == "on") watchState = true;
+    else if (args == "input") watchState = watchInput = true;
+    else if (args == "off") watchState = watchInput = false;
+    Serial.print("watch=");
+    Serial.println(watchInput ? "input" : watchState ? "on" : "off");
+  }
+  else if (cmdLower == "get_link") {
+    RadioLinkStats l = radio_link_stats();
+    Serial.print("link_lost=");          Serial.println(l.lost ? "true" : "false");
+    Serial.print("last_rx_age_ms=");     Serial.println(millis() - radio_last_rx_ms());
+    Serial.print("losses=");             Serial.println(l.losses);
+    Serial.print("keepalives=");         Serial.println(l.keepalives);
+    Serial.print("last_detect_ms=");     Serial.println(l.last_detect_ms);
+    Serial.print("max_detect_ms=");      Serial.println(l.max_detect_ms);
+    Serial.print("last_reconnect_ms=");  Serial.println(l.last_reconnect_ms);
+    Serial.print("dropped_on_loss=");    Serial.println(l.dropped_on_loss);
+    Serial.print("queue_depth=");        Serial.print(radio_queue_depth());
+    Serial.print("/");                   Serial.println(radio_queue_capacity());
+    Serial.print("queue_busy=");         Serial.println(radio_queue_busy() ? "true" : "false");
+    Serial.print("tx_queue_full=");      Serial.println(l.tx_queue_full);
+    Serial.print("rejected_not_ready="); Serial.println(l.rejected_not_ready);
+    Serial.print("ack_timeouts=");       Serial.println(l.ack_timeouts);
+    Serial.print("freq_resends=");       Serial.println(l.freq_resends);
+    Serial.print("freq_give_ups=");      Serial.println(l.freq_give_ups);
+    Serial.print("freq_adopted=");       Serial.println(l.freq_adopted);
   }
   else if (cmdLower == "connect") {
-    radio_send_connect();
+    printAdmit("connect", radio_send_connect());
   }
   else if (cmdLower == "disconnect") {
-    radio_send_disconnect();
+    printAdmit("disconnect", radio_send_disconnect());
   }
   // ✅ NEU: Radio raw command
   else if (cmdLower == "radio_raw") {
     if (args.length() == 0) {
-      Serial.println("Usage: radio_raw <command>");
+      Serial.println("Usage: radio_raw <command>   (max. " + String(RADIO_RAW_CORE_MAX) + " Zeichen)");
       Serial.println("Example: radio_raw FF SRF 1500000");
     } else {
       // sendet z.B. "M:" + args + "\r\n" (je nach radio_build/config)
-      radio_send_raw(args);
-      Serial.println("OK sent: " + args);
+      printAdmit(args.c_str(), radio_send_raw(args));
       // Serial.println(args);
     }
   }
 
   // ✅ Praktische Shortcuts (optional, aber nützlich)
   else if (cmdLower == "radio_get_rxfreq") {
-    radio_query_rxfreq();
-    Serial.println("OK query rx freq");
+    printAdmit("query rx freq", radio_query_rxfreq());
   }
   else if (cmdLower == "radio_get_preset") {
-    radio_query_presetpage();
-    Serial.println("OK query preset page");
+    printAdmit("query preset page", radio_query_presetpage());
+  }
+
+  else if (cmdLower == "get_telemetry") {
+    Serial.print("telemetry=");
+    Serial.print(radio_telemetry_enabled() ? "on" : "off");
+    Serial.print(" period_ms=");
+    Serial.println(radio_telemetry_period_ms());
+    for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+      TelemetryChannel ch = (TelemetryChannel)i;
+      int16_t v;
+      uint32_t at;
+      Serial.print(telemetry_channel_name(ch));
+      Serial.print("=");
+      if (telemetry_latest(ch, v, at)) {
+        Serial.print(v);
+        Serial.print(" age_ms=");
+        Serial.print(millis() - at);
+      } else {
+        Serial.print("-");
+      }
+      Serial.print(" samples=");
+      Serial.println(telemetry_next_seq(ch) - telemetry_first_seq(ch));
+    }
+  }
+  else if (cmdLower == "telemetry") {
+    if (args == "on") radio_telemetry_enable(true);
+    else if (args == "off") radio_telemetry_enable(false);
+    else if (args.toInt() > 0) radio_telemetry_set_period((uint32_t)args.toInt());
+    else {
+      Serial.println("Usage: telemetry on|off|<period ms>");
+      return;
+    }
+    Serial.println("OK");
   }
 
   else if (cmdLower == "reboot") {
@@ -134,6 +336,83 @@ static void handleCommand(const String& lineRaw) {
     delay(200);
     ESP.restart();
   }
+  else if (cmdLower == "get_encoder") {
+    EncoderStats e = encoderStats();
+    Serial.print("events=");           Serial.println(e.events);
+    Serial.print("max_depth=");        Serial.print(e.max_depth);
+    Serial.print("/");                 Serial.println(ENC_EVENT_QUEUE_LEN);
+    Serial.print("overflow_events=");  Serial.println(e.overflow_events);
+    Serial.print("buttons_dropped=");  Serial.println(e.buttons_dropped);
+  }
+  else if (cmdLower == "get_display") {
+    DisplayFlushStats d = displayFlushStats();
+    Serial.print("frames=");          Serial.println(d.frames);
+    Serial.print("full_frames=");     Serial.println(d.full_frames);
+    Serial.print("skipped_frames=");  Serial.println(d.skipped_frames);
+    Serial.print("last_pages=");      Serial.println(d.last_pages);
+    Serial.print("last_runs=");       Serial.println(d.last_runs);
+    Serial.print("last_bytes=");      Serial.println(d.last_bytes);
+    Serial.print("avg_bytes=");       Serial.println(d.frames ? d.total_bytes / d.frames : 0);
+    Serial.print("last_us=");         Serial.println(d.last_us);
+    Serial.print("max_us=");          Serial.println(d.max_us);
+    Serial.print("async=");           Serial.println(d.async ? "yes" : "no");
+    Serial.print("posted=");          Serial.println(d.posted);
+    Serial.print("dropped_frames=");  Serial.println(d.dropped_frames);
+    Serial.print("render_us=");       Serial.println(d.last_render_us);
+    Serial.print("render_max_us=");   Serial.println(d.max_render_us);
+    Serial.print("last_layers=0x");   Serial.println(d.last_layers, HEX);
+    Serial.print("fps=");             Serial.println(d.fps_x10 / 10.0f, 1);
+    Serial.print("loop_load=");       Serial.print(d.load_permille / 10.0f, 1); Serial.println("%");
+    Serial.print("coalesced=");       Serial.println(d.coalesced);
+    Serial.print("stale_refreshes="); Serial.println(d.stale_refreshes);
+    Serial.print("frame_interval_ms="); Serial.println(d.frame_interval_ms);
+    Serial.print("paced=");           Serial.println(d.paced);
+    Serial.print("settle_frames=");   Serial.println(d.settle_frames);
+    Serial.print("i2c_hz=");          Serial.println(d.i2c_hz);
+    Serial.print("i2c_transactions="); Serial.println(d.transactions);
+    printHistogram("render_us", d.render_us);
+    printHistogram("flush_us", d.flush_us);
+    printHistogram("frame_bytes", d.frame_bytes);
+  }
+  else if (cmdLower == "display_refresh") {
+    displayForceRefresh();
+    Serial.println("OK");
+  }
+  else if (cmdLower == "display_reset") {
+    displayResetStats();
+    Serial.println("OK");
+  }
+  else if (cmdLower == "display_bench") {
+    DisplayBusBench b = displayBusBench();
+    if (!b.ok) {
+      Serial.println("ERR display_bench (no frame yet or I2C error)");
+    } else {
+      Serial.print("lean ");        Serial.print(b.clock_hz / 1000); Serial.print(" kHz: ");
+      Serial.print(b.lean_us);      Serial.print(" us, ");
+      Serial.print(b.lean_bytes);   Serial.print(" B, ");
+      Serial.print(b.lean_txns);    Serial.println(" txn");
+      Serial.print("lean 400 kHz: "); Serial.print(b.lean_400k_us); Serial.println(" us");
+      Serial.print("adafruit 400 kHz: "); Serial.print(b.adafruit_us); Serial.print(" us, ");
+      Serial.print(b.adafruit_bytes); Serial.print(" B, ");
+      Serial.print(b.adafruit_txns);  Serial.println(" txn");
+    }
+  }
+  else if (cmdLower == "get_latency") {
+    // µs je Quelle und Stufe, leere Stufen weglassen
+    for (uint8_t o = 0; o < (uint8_t)LatencyOrigin::COUNT; o++) {
+      for (uint8_t st = 0; st < (uint8_t)LatencyStage::COUNT; st++) {
+        LatencyHistogram h = latency_histogram((LatencyOrigin)o, (LatencyStage)st);
+        if (!h.total()) continue;
+        String name = String(latency_origin_name((LatencyOrigin)o)) + "." +
+                      latency_stage_name((LatencyStage)st);
+        printHistogram(name.c_str(), h);
+      }
+    }
+  }
+  else if (cmdLower == "latency_reset") {
+    latency_reset();
+    Serial.println("OK");
+  }
   else if (cmdLower == "get_button_state"){
     bool now = digitalRead(ENC_BTN);
     Serial.print("Button_state: ");
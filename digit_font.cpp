@@ -0,0 +1,73 @@
+#include "digit_font.h"
+
+// Eine Zeile pro uint16_t, Bit 11 = linke Spalte. Erzeugt aus glcdfont
+// (Spalten 0..4, Zeilen 0..6) mit Faktor 2; Spalten 10/11 und Zeilen 14/15
+// sind der Zeichenabstand.
+static const uint16_t GLYPHS[11][DIGIT_FONT_H] PROGMEM = {
+  { 0x3F0, 0x3F0, 0xC0C, 0xC0C, 0xC3C, 0xC3C, 0xCCC, 0xCCC, 0xF0C, 0xF0C, 0xC0C, 0xC0C, 0x3F0, 0x3F0, 0x000, 0x000 },  // '0'
+  { 0x0C0, 0x0C0, 0x3C0, 0x3C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x3F0, 0x3F0, 0x000, 0x000 },  // '1'
+  { 0x3F0, 0x3F0, 0xC0C, 0xC0C, 0x00C, 0x00C, 0x3F0, 0x3F0, 0xC00, 0xC00, 0xC00, 0xC00, 0xFFC, 0xFFC, 0x000, 0x000 },  // '2'
+  { 0xFFC, 0xFFC, 0x00C, 0x00C, 0x030, 0x030, 0x0F0, 0x0F0, 0x00C, 0x00C, 0xC0C, 0xC0C, 0x3F0, 0x3F0, 0x000, 0x000 },  // '3'
+  { 0x030, 0x030, 0x0F0, 0x0F0, 0x330, 0x330, 0xC30, 0xC30, 0xFFC, 0xFFC, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000 },  // '4'
+  { 0xFFC, 0xFFC, 0xC00, 0xC00, 0xFF0, 0xFF0, 0x00C, 0x00C, 0x00C, 0x00C, 0xC0C, 0xC0C, 0x3F0, 0x3F0, 0x000, 0x000 },  // '5'
+  { 0x0FC, 0x0FC, 0x300, 0x300, 0xC00, 0xC00, 0xFF0, 0xFF0, 0xC0C, 0xC0C, 0xC0C, 0xC0C, 0x3F0, 0x3F0, 0x000, 0x000 },  // '6'
+  { 0xFFC, 0xFFC, 0x00C, 0x00C, 0x00C, 0x00C, 0x030, 0x030, 0x0C0, 0x0C0, 0x300, 0x300, 0xC00, 0xC00, 0x000, 0x000 },  // '7'
+  { 0x3F0, 0x3F0, 0xC0C, 0xC0C, 0xC0C, 0xC0C, 0x3F0, 0x3F0, 0xC0C, 0xC0C, 0xC0C, 0xC0C, 0x3F0, 0x3F0, 0x000, 0x000 },  // '8'
+  { 0x3F0, 0x3F0, 0xC0C, 0xC0C, 0xC0C, 0xC0C, 0x3FC, 0x3FC, 0x00C, 0x00C, 0x030, 0x030, 0xFC0, 0xFC0, 0x000, 0x000 },  // '9'
+  { 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3C0, 0x3C0, 0x3C0, 0x3C0, 0x000, 0x000 },  // '.'
+};
+
+static int8_t glyphIndex(char c) {
+  if (c >= '0' && c <= '9') return (int8_t)(c - '0');
+  if (c == '.') return 10;
+  return -1;
+}
+
+// Rotation 3 (OLED_ROTATION): logische Zeile y ist Display-Spalte y,
+// logische Spalte x ist Display-Zeile HEIGHT-1-x. Eine Sprite-Zeile landet
+// damit in einer Display-Spalte und wird als 12-Bit-Wert in 2-3 Page-Bytes
+// geodert, statt 12 einzelne Pixel zu setzen.
+static void blitRot3(uint8_t* buf, int16_t physW, int16_t physH,
+                     int16_t x, int16_t y, const uint16_t* rows) {
+  const int16_t yBase = (int16_t)(physH - DIGIT_FONT_W - x);   // Display-Zeile von Bit 0
+  const uint8_t shift = (uint8_t)(yBase & 7);
+  uint8_t* col = buf + (yBase >> 3) * physW + y;
+
+  for (int16_t r = 0; r < DIGIT_FONT_H; r++) {
+    uint32_t bits = (uint32_t)pgm_read_word(&rows[r]) << shift;
+    if (!bits) continue;
+    uint8_t* p = col + r;
+    p[0] |= (uint8_t)bits;
+    if (bits >> 8)  p[physW] |= (uint8_t)(bits >> 8);
+    if (bits >> 16) p[2 * physW] |= (uint8_t)(bits >> 16);
+  }
+}
+
+// Andere Rotationen oder Randbereiche: über drawPixel (mit Clipping)
+static void blitGeneric(SH1107Panel& d, int16_t x, int16_t y, const uint16_t* rows) {
+  for (int16_t r = 0; r < DIGIT_FONT_H; r++) {
+    uint16_t bits = pgm_read_word(&rows[r]);
+    for (int16_t c = 0; bits && c < DIGIT_FONT_W; c++) {
+      if (bits & (0x800 >> c)) d.drawPixel(x + c, y + r, SH110X_WHITE);
+    }
+  }
+}
+
+void digitFontDraw(SH1107Panel& d, int16_t x, int16_t y, const char* s) {
+  uint8_t* buf = d.getBuffer();
+  // Display-Maße: bei Rotation 3 sind width()/height() vertauscht
+  const int16_t physW = d.height();
+  const int16_t physH = d.width();
+  const bool fast = buf && d.getRotation() == 3 &&
+                    y >= 0 && y + DIGIT_FONT_H <= d.height();
+
+  for (; *s; s++, x += DIGIT_FONT_W) {
+    int8_t g = glyphIndex(*s);
+    if (g < 0) continue;
+    if (fast && x >= 0 && x + DIGIT_FONT_W <= d.width()) {
+      blitRot3(buf, physW, physH, x, y, GLYPHS[g]);
+    } else {
+      blitGeneric(d, x, y, GLYPHS[g]);
+    }
+  }
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+#include "sh1107_panel.h"
+
+// Große Ziffern für die Frequenzanzeige als fertige Sprites im Flash.
+// Pixelgleich mit GFX-Textgröße 2 (glcdfont 5x7, verdoppelt), aber mit
+// fester Breite: Positionen und Unterstreichungen sind reine Arithmetik,
+// ohne getTextBounds() und ohne Pixel-für-Pixel-Zeichnen.
+
+static constexpr int16_t DIGIT_FONT_W = 12;   // Zeichenzelle inkl. Abstand
+static constexpr int16_t DIGIT_FONT_H = 16;
+
+static constexpr int16_t digitFontWidth(size_t chars) {
+  return (int16_t)(chars * DIGIT_FONT_W);
+}
+
+// Zeichnet '0'..'9' und '.' ab (x,y) (linke obere Ecke, logische Koordinaten).
+// Andere Zeichen bleiben leer, rücken aber eine Zelle weiter.
+void digitFontDraw(SH1107Panel& d, int16_t x, int16_t y, const char* s);
@@ -1,17 +1,96 @@
 #pragma once
 #include <Arduino.h>
 #include "config.h"
+#include "histogram.h"
 
 
 bool displayInit();
 void displayTick();
+void displayTickPeriodic();           // wie displayTick, plus Voll-Refresh nach UI_MAX_STALE_MS
+void displayRender();                 // sofort zeichnen, ohne UI_MIN_REFRESH_MS
+void displayForceRefresh();           // alle Layer neu zeichnen und komplett übertragen
 
-// Status im Header
-void displaySetConnected(bool connected);
-void displaySetMode(RadioMode mode);
+// Eingabe für das Frame-Pacing: Drehgeschwindigkeit und Füllstand der Radio-Queue
+void displayNoteInput(uint16_t detentsPerSec, uint8_t linkLoadPct);
 
-// Main Value
-void displaySetFrequencyHz(uint32_t hz);
+// Zuletzt gerenderter Frame im SH1107-Format: OLED_W Spalten x OLED_H/8 Pages,
+// Bit 0 = oberste Zeile der Page (unrotiert). Direkter Zugriff nur aus loop().
+const uint8_t* displayFramebuffer();
+uint32_t displayFrameVersion();       // +1 bei jedem Frame, in dem ein Layer neu gezeichnet wurde
+// Aus anderen Tasks: Kopie des letzten fertigen Frames (OLED_W * OLED_H / 8
+// Bytes) nach dst, Rückgabe ist dessen Version
+uint32_t displayFrameCopy(uint8_t* dst);
+
+// Bildschirm-Layer (waagrechte Bänder, von oben nach unten gezeichnet)
+enum class DisplayLayer : uint8_t {
+  Chrome,      // Trennlinien
+  Header,      // Mode + Verbindungsstatus
+  Marker,      // TUNE/SEL + Einheit
+  Frequency,   // große Ziffern + Cursor
+  Footer,      // Menü
+  COUNT
+};
+
+// Render-/Flush-Zeiten in µs bzw. Bytes: bis 2^17
+typedef Log2Histogram<18> DisplayHistogram;
+
+// Flush-Statistik: nur geänderte Pages/Spalten gehen über I2C
+struct DisplayFlushStats {
+  uint32_t frames = 0;          // Flush-Aufrufe
+  uint32_t full_frames = 0;     // komplett übertragen (Start / invalidiert)
+  uint32_t skipped_frames = 0;  // nichts geändert -> kein I2C
+  uint8_t last_pages = 0;       // geänderte Pages im letzten Frame
+  uint8_t last_runs = 0;        // übertragene Spaltenbereiche im letzten Frame
+  uint16_t last_bytes = 0;      // I2C-Nutzbytes im letzten Frame (inkl. Control-Bytes)
+  uint32_t total_bytes = 0;
+  uint32_t last_us = 0;         // Dauer des letzten Flush
+  uint32_t max_us = 0;
+  // Double Buffering (DISPLAY_ASYNC_FLUSH)
+  bool async = false;           // Flush läuft in eigener Task
+  uint32_t posted = 0;          // an die Flush-Task übergebene Frames
+  uint32_t dropped_frames = 0;  // vor der Übertragung von neuerem Frame überholt
+  uint32_t last_render_us = 0;  // Zeichnen + Übergabe, ohne I2C (im Sync-Betrieb inkl. Flush)
+  uint32_t max_render_us = 0;
+  uint8_t last_layers = 0;      // im letzten Frame neu gezeichnete Layer (Bit = DisplayLayer)
+  // Verteilungen und Raten
+  DisplayHistogram render_us;   // displayRender() in loop()
+  DisplayHistogram flush_us;    // I2C-Übertragung pro Frame
+  DisplayHistogram frame_bytes; // I2C-Bytes pro Frame
+  uint32_t coalesced = 0;       // Änderungen, die in einen schon fälligen Frame eingingen
+  uint32_t stale_refreshes = 0; // Voll-Refresh nach UI_MAX_STALE_MS
+  uint16_t fps_x10 = 0;         // gerenderte Frames/s * 10, letztes volles Sekundenfenster
+  uint16_t load_permille = 0;   // Anteil von loop()-Zeit in displayRender(), gleiches Fenster
+  // Frame-Pacing
+  uint16_t frame_interval_ms = 0; // aktueller Mindestabstand zwischen Frames
+  uint32_t paced = 0;           // Frames, die wegen Pacing später kamen
+  uint32_t settle_frames = 0;   // Endframes nach Ende einer Drehbewegung
+  // Bus
+  uint32_t i2c_hz = 0;          // eingestellter I2C-Takt (nach Rückfall)
+  uint32_t transactions = 0;    // I2C-Transaktionen seit Start
+};
+
+DisplayFlushStats displayFlushStats();
+void displayResetStats();
+
+// Vollbild-Übertragung gemessen (Konsole: display_bench): schlanker Treiber
+// mit OLED_I2C_HZ und mit 400 kHz gegen das Übertragungsmuster von
+// Adafruit_SH110X (Command-Transaktion + 127-Byte-Häppchen, 400 kHz).
+struct DisplayBusBench {
+  bool ok = false;
+  uint32_t clock_hz = 0;
+  uint32_t lean_us = 0;
+  uint32_t lean_400k_us = 0;
+  uint32_t adafruit_us = 0;
+  uint16_t lean_bytes = 0;
+  uint16_t lean_txns = 0;
+  uint16_t adafruit_bytes = 0;
+  uint16_t adafruit_txns = 0;
+};
+
+DisplayBusBench displayBusBench();
+
+// Header (Mode, Verbindung, busy) und Frequenz kommen aus app_state.h;
+// displayInit() meldet sich dort an und markiert die Layer bei Änderungen.
 
 void displaySetTuneCursor(uint8_t idx);   // 0..4
 void displaySetTuneSelect(bool on);       // Cursor-Select aktiv?
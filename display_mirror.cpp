@@ -0,0 +1,81 @@
+#include "display_mirror.h"
+#include "display.h"
+#include "config_display.h"
+
+static constexpr size_t FRAME_BYTES = OLED_W * OLED_H / 8;
+// Worst Case: alles Literal, ein Token je 128 Bytes
+static constexpr size_t OUT_MAX = FRAME_BYTES + FRAME_BYTES / 128;
+
+// Stand, den der zuletzt bediente Client hat
+static uint8_t baseline[FRAME_BYTES];
+static uint32_t baselineVersion = 0;
+static bool baselineValid = false;
+
+static uint8_t frame[FRAME_BYTES];   // Kopie von displayFrameCopy()
+static uint8_t out[OUT_MAX];
+static DisplayMirrorStats stats;
+
+static size_t encodeXorRle(const uint8_t* cur, const uint8_t* base, uint8_t* dst) {
+  size_t n = 0, i = 0;
+  while (i < FRAME_BYTES) {
+    // unveränderte Bytes
+    size_t run = 0;
+    while (i + run < FRAME_BYTES && (cur[i + run] ^ (base ? base[i + run] : 0)) == 0) run++;
+    i += run;
+    while (run) {
+      size_t k = run > 128 ? 128 : run;
+      dst[n++] = (uint8_t)(k - 1);
+      run -= k;
+    }
+    if (i >= FRAME_BYTES) break;
+
+    // geänderte Bytes als Literal; einzelne gleiche Bytes dazwischen
+    // mitnehmen ist billiger als ein Skip-Token plus neues Literal
+    size_t start = i, end = i;
+    while (end < FRAME_BYTES && end - start < 128) {
+      uint8_t x = cur[end] ^ (base ? base[end] : 0);
+      if (x == 0) {
+        bool shortGap = end + 1 < FRAME_BYTES && end + 1 - start < 128 &&
+                        (cur[end + 1] ^ (base ? base[end + 1] : 0)) != 0;
+        if (!shortGap) break;
+      }
+      end++;
+    }
+    dst[n++] = (uint8_t)(0x7F + (end - start));
+    for (size_t j = start; j < end; j++) dst[n++] = cur[j] ^ (base ? base[j] : 0);
+    i = end;
+  }
+  return n;
+}
+
+const uint8_t* displayMirrorEncode(uint32_t clientVersion, size_t& len,
+                                   uint32_t& version, bool& keyframe) {
+  stats.requests++;
+  version = displayFrameVersion();
+  keyframe = false;
+  len = 0;
+
+  if (clientVersion == version && clientVersion != 0) {
+    stats.unchanged++;
+    return nullptr;
+  }
+
+  version = displayFrameCopy(frame);
+  const uint8_t* cur = frame;
+  keyframe = !baselineValid || clientVersion != baselineVersion || clientVersion == 0;
+  len = encodeXorRle(cur, keyframe ? nullptr : baseline, out);
+
+  memcpy(baseline, cur, FRAME_BYTES);
+  baselineVersion = version;
+  baselineValid = true;
+
+  if (keyframe) stats.keyframes++;
+  else stats.deltas++;
+  stats.bytes += len;
+  stats.last_bytes = (uint16_t)len;
+  return out;
+}
+
+DisplayMirrorStats displayMirrorStats() {
+  return stats;
+}
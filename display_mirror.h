@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+
+// Spiegel des OLED-Framebuffers für die Web-UI.
+//
+// Der Client nennt den Frame-Stand, den er schon hat; zurück kommt nur das
+// XOR zu diesem Stand, lauflängenkodiert. Kennt der Server den Stand nicht
+// mehr (zweiter Client, Neustart), kommt ein Keyframe (XOR gegen leer).
+// Läuft im Web-Handler (AsyncTCP-Task) und kodiert aus displayFrameCopy(),
+// nie aus dem Frame-Puffer, den loop() gerade zeichnet.
+//
+// Format: Folge von Tokens über die 2048 Bytes des SH1107-Puffers
+// (OLED_W Spalten x OLED_H/8 Pages, Bit 0 = oberste Zeile der Page):
+//   0x00..0x7F  n+1 Bytes unverändert überspringen
+//   0x80..0xFF  n-0x7F Bytes folgen, die auf den Stand ge-XOR-t werden
+
+struct DisplayMirrorStats {
+  uint32_t requests = 0;
+  uint32_t unchanged = 0;   // Client war aktuell
+  uint32_t deltas = 0;
+  uint32_t keyframes = 0;
+  uint32_t bytes = 0;       // Nutzdaten gesamt
+  uint16_t last_bytes = 0;
+};
+
+// Update für einen Client mit Stand clientVersion kodieren.
+// nullptr = nichts Neues; sonst Zeiger auf len Bytes (gültig bis zum nächsten Aufruf).
+const uint8_t* displayMirrorEncode(uint32_t clientVersion, size_t& len,
+                                   uint32_t& version, bool& keyframe);
+
+DisplayMirrorStats displayMirrorStats();
@@ -1,24 +1,58 @@
 #include "display.h"
 #include "config_display.h"
+#include "app_state.h"
+#include "app_events.h"
+#include "latency_trace.h"
 
 #include <Arduino.h>
 #include <Wire.h>
 #include <Adafruit_GFX.h>
-#include <Adafruit_SH110X.h>
+#include "sh1107_partial.h"
+#include "digit_font.h"
 
 
 // -------- Display Objekt --------
-// Adafruit_SH1107 erwartet Breite/Höhe und &Wire
-static Adafruit_SH1107 display(OLED_W, OLED_H, &Wire, -1);
+// Eigener SH1107-Treiber (sh1107_panel.h), Zeichnen über Adafruit_GFX.
+// SH1107Partial überträgt bei display() nur, was sich seit dem letzten Frame geändert hat.
+static_assert(OLED_W == SH1107Panel::PANEL_W && OLED_H == SH1107Panel::PANEL_H, "Panelgröße");
+static SH1107Partial display(&Wire);
 
 static bool uiDirty = true;          // beim Start einmal zeichnen
 static uint32_t lastRenderMs = 0;
+static uint32_t lastRenderUs = 0;
+static uint32_t maxRenderUs = 0;
+
+// Metriken (nur loop()-Seite; Flush-Seite zählt SH1107Partial)
+static DisplayHistogram renderHist;
+static uint32_t coalesced = 0;
+static uint32_t staleRefreshes = 0;
+static uint32_t winStartMs = 0;     // Sekundenfenster für fps/Last
+static uint32_t winFrames = 0;
+static uint32_t winRenderUs = 0;
+static uint16_t fpsX10 = 0;
+static uint16_t loadPermille = 0;
+
+// Frame-Pacing (displayNoteInput)
+static uint32_t lastInputMs = 0;
+static uint16_t inputVelocity = 0;
+static uint8_t linkLoadPct = 0;
+static bool spinning = false;
+static uint16_t frameIntervalMs = UI_MIN_REFRESH_MS;
+static uint32_t pacedFrames = 0;
+static bool pacedPending = false;    // aktueller Frame wurde schon als verzögert gezählt
+static uint32_t settleFrames = 0;
 
 uint8_t tuneCursor = 2;   // 1kHz default
 bool tuneSelect = false;
 
 
-static inline void markDirty() {
+// Versionszähler pro Layer: Setter zählen hoch, displayRender() zeichnet nur
+// Layer neu, deren Version vom Stand im Cache abweicht.
+static uint16_t layerVersion[(uint8_t)DisplayLayer::COUNT] = {1, 1, 1, 1, 1};
+
+static inline void markLayer(DisplayLayer l) {
+  layerVersion[(uint8_t)l]++;
+  if (uiDirty) coalesced++;   // geht in den ohnehin fälligen Frame ein
   uiDirty = true;
 }
 
@@ -32,11 +66,21 @@ static const char* modeToText(RadioMode m) {
   }
 }
 
-struct UiState {
-  RadioMode mode = RadioMode::UNKNOWN;
-  uint32_t freq_hz = 1500;
-  bool connected = false;
+// Angefordert, ACK steht noch aus
+static const char* modePendingText(RadioMode m) {
+  switch (m) {
+    case RadioMode::CW:  return "[CW..]";
+    case RadioMode::USB: return "[USB..]";
+    case RadioMode::LSB: return "[LSB..]";
+    case RadioMode::AM:  return "[AM..]";
+    case RadioMode::FM:  return "[FM..]";
+    default:             return "[..]";
+  }
+}
 
+// Nur was allein die Anzeige betrifft; Frequenz, Mode, Verbindung und
+// Queue-Zustand kommen aus frameState.
+struct UiState {
   bool tuneMarker = false;  
   uint8_t tuneCursor = 2; // default 1 KHZ
   bool tuneSelect = false;
@@ -49,6 +93,10 @@ struct UiState {
 
 static UiState ui;
 
+// Ein Snapshot pro Frame: alle Layer zeichnen denselben Stand, auch wenn
+// währenddessen geschrieben wird.
+static AppState frameState;
+
 enum class FreqUnit : uint8_t {
   KHZ,
   MHZ
@@ -56,14 +104,18 @@ enum class FreqUnit : uint8_t {
 
 // ---------- Helpers ----------
 
+static FreqUnit freqUnitFor(uint32_t hz) {
+  return (hz < 30000000UL) ? FreqUnit::KHZ : FreqUnit::MHZ;
+}
+
 
 void formatFrequency(char* value,
                      size_t valueSize,
                      FreqUnit& unit,
                      uint32_t hz)
 {
-  if (hz < 30000000UL) {          // < 30 MHz → kHz
-    unit = FreqUnit::KHZ;
+  unit = freqUnitFor(hz);
+  if (unit == FreqUnit::KHZ) {    // < 30 MHz → kHz
 
     uint32_t whole = hz / 1000UL;
     uint32_t frac  = hz % 1000UL;
@@ -73,8 +125,6 @@ void formatFrequency(char* value,
              (unsigned long)whole,
              (unsigned long)frac);
   } else {                        // ≥ 30 MHz → MHz
-    unit = FreqUnit::MHZ;
-
     uint32_t whole = hz / 1000000UL;
     uint32_t frac  = (hz % 1000000UL) / 1000UL;
 
@@ -86,38 +136,48 @@ void formatFrequency(char* value,
 }
 
 
-// Textbreite in Pixeln (bei aktueller TextSize)
+// Textbreite in Pixeln für den eingebauten 6x8-Font (fest, kein getTextBounds)
 static int16_t textWidthPx(const char* s) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(s, 0, 0, &x1, &y1, &w, &h);
-  return (int16_t)w;
+  return (int16_t)(strlen(s) * 6);
 }
 
 // ---------- Zeichnen ----------
-static void drawHeader(const UiState& s) {
+static void drawHeader(const UiState&) {
+  const AppState& a = frameState;
   display.setTextSize(1);
   display.setTextColor(SH110X_WHITE);
 
-  // Mode links
+  // Mode links, offener Mode-Wechsel mit dem angeforderten Mode
   display.setCursor(0, 4);
-  display.print(modeToText(s.mode));
-
-  // Connection rechts
-  const char* conn = s.connected ? "[connected]" : "[disconnected]";
+  bool modePending = a.link == RadioState::WAIT_SET_MODE_ACK && a.desired_mode != a.mode;
+  display.print(modePending ? modePendingText(a.desired_mode) : modeToText(a.mode));
+
+  // Connection rechts (volle Radio-Queue hat Vorrang, dann offenes REMOTE an/aus)
+  const char* conn = a.busy ? "[busy]"
+                   : a.link == RadioState::WAIT_CONNECT_ACK ? "[connecting]"
+                   : a.link == RadioState::WAIT_DISCONNECT_ACK ? "[disconn..]"
+                   : (a.connected ? "[connected]" : "[disconnected]");
   int16_t w = textWidthPx(conn);
   display.setCursor(OLED_W - w, 4);
   display.print(conn);
-
-  display.drawLine(0, UI_HEADER_H - 1, OLED_W - 1, UI_HEADER_H - 1, SH110X_WHITE);
 }
 
+// Zeile unter dem Header: TUNE/SEL links, Einheit rechts
 static void drawTuneMarker(const UiState& s) {
-  if (!s.tuneMarker) return;
-
   display.setTextSize(1);
   display.setTextColor(SH110X_WHITE);
 
+  display.setCursor(OLED_W - 24, UI_HEADER_H + 2);
+  display.print(freqUnitFor(frameState.freq_hz) == FreqUnit::MHZ ? "MHz" : "kHz");
+
+  // Angezeigte Frequenz ist nur der Wunsch, das Radio hat sie noch nicht bestätigt
+  if (!app_state_freq_confirmed(frameState)) {
+    display.setCursor(OLED_W - 32, UI_HEADER_H + 2);
+    display.print('~');
+  }
+
+  if (!s.tuneMarker) return;
+
   display.setCursor(0, UI_HEADER_H + 2);
   display.print("TUNE");
 
@@ -128,7 +188,7 @@ static void drawTuneMarker(const UiState& s) {
 }
 
 static void underlineRange(int16_t x, int16_t y, int16_t w) {
-  int16_t uy = y + 18; // bei TextSize 2 meist passend
+  int16_t uy = y + DIGIT_FONT_H + 2;
   display.drawLine(x, uy, x + w - 1, uy, SH110X_WHITE);
 }
 
@@ -136,208 +196,76 @@ static void underlineRange(int16_t x, int16_t y, int16_t w) {
 void displaySetTuneCursor(uint8_t idx) {
   if (ui.tuneCursor == idx) return;
   ui.tuneCursor = idx;
-  markDirty();
+  if (ui.tuneMarker) markLayer(DisplayLayer::Frequency);   // Unterstreichung
 }
 
 void displaySetTuneSelect(bool on) {
   if (ui.tuneSelect == on) return;
   ui.tuneSelect = on;
-  markDirty();
+  markLayer(DisplayLayer::Marker);
 }
 
-static void formatKHz3(char* out, size_t outSize, uint32_t hz) {
-  uint32_t whole = hz / 1000UL; // kHz
-  uint32_t frac  = hz % 1000UL; // Hz -> .xxx kHz
-  snprintf(out, outSize, "%lu.%03lu",
-           (unsigned long)whole, (unsigned long)frac);
-}
-
-
-static void formatMHz6(char* out, size_t outSize, uint32_t hz) {
-  uint32_t whole = hz / 1000000UL;
-  uint32_t frac  = hz % 1000000UL; // .xxxxxx MHz
-  snprintf(out, outSize, "%lu.%06lu",
-           (unsigned long)whole, (unsigned long)frac);
+// Unterstrichener Zeichenbereich im Frequenzstring für den Tune-Cursor
+// (idx: 0=1MHz, 1=100kHz, 2=1kHz, 3=100Hz, 4=1Hz). false = Stelle nicht sichtbar.
+static bool tuneCursorSpan(uint8_t idx, FreqUnit unit, int L, int& first, int& count) {
+  // L = Stellen vor dem Punkt, Nachkommastellen beginnen bei L+1
+  count = 1;
+  if (unit == FreqUnit::KHZ) {
+    // "<kHz>.<hhh>"
+    switch (idx) {
+      case 0:   // MHz-Anteil = alles vor den letzten 3 kHz-Stellen
+        first = 0;
+        count = (L > 3) ? L - 3 : L;
+        return count > 0;
+      case 1:  first = L - 3; break;
+      case 2:  first = L - 1; break;
+      case 3:  first = L + 1; break;
+      case 4:  first = L + 3; break;
+      default: return false;
+    }
+  } else {
+    // "<MHz>.<kkk>" – 100 Hz und 1 Hz werden nicht angezeigt
+    switch (idx) {
+      case 0:  first = 0; count = L; break;
+      case 1:  first = L + 1; break;
+      case 2:  first = L + 3; break;
+      default: return false;
+    }
+  }
+  return first >= 0;
 }
 
 static void drawFrequency(const UiState& s) {
   char value[16];
   FreqUnit unit;
-  const bool useMHz = (s.freq_hz >= 30000000UL);
-  const char* unitStr = nullptr;
-
-
-  if (useMHz) {
-    formatMHz6(value, sizeof(value), s.freq_hz);
-    unitStr = "MHz";
-  } else {
-    formatKHz3(value, sizeof(value), s.freq_hz);
-    unitStr = "kHz";
-  }
-
-  formatFrequency(value, sizeof(value), unit, s.freq_hz);
+  formatFrequency(value, sizeof(value), unit, frameState.freq_hz);
+  const size_t len = strlen(value);
 
   // ---------- große Zahl ----------
-  display.setTextColor(SH110X_WHITE);
-  display.setTextSize(2);
-
-  int16_t valueW = textWidthPx(value);
+  int16_t valueW = digitFontWidth(len);
   int16_t x = (OLED_W - valueW) / 2;
 
   int mainTop = UI_HEADER_H;
   int mainBottom = OLED_H - UI_FOOTER_H;
   int mainH = mainBottom - mainTop;
 
-  int16_t valueH = 16; // TextSize 2 ≈ 16px
-  int16_t y = mainTop + (mainH - valueH) / 2;
+  int16_t y = mainTop + (mainH - DIGIT_FONT_H) / 2;
 
-  display.setCursor(x, y);
-  display.print(value);
-
-  // ---------- Einheit ----------
-  display.setTextSize(1);
-
-  int16_t ux = x + valueW + 4;   // kleiner Abstand rechts
-  int16_t uy = y + 8;            // optisch mittig zur Zahl
-
-  // display.setCursor(ux, uy);
-  display.setCursor(OLED_W - 24, UI_HEADER_H + 2);
-  display.print(unitStr);
+  digitFontDraw(display, x, y, value);
 
   // Cursor-Unterstreichung (nur wenn Tune aktiv)
   if (s.tuneMarker) {
-  const char* dot = strchr(value, '.');
-  if (dot) {
-    // Split links und rechts
-    char left[16] = {0};
-    size_t leftLen = (size_t)(dot - value);
-    if (leftLen >= sizeof(left)) leftLen = sizeof(left) - 1;
-    memcpy(left, value, leftLen);
-    left[leftLen] = 0;
-
-    char point[2] = {'.', 0};
-
-    // Rechte Seite (Nachkommastellen)
-    const char* frac = dot + 1;
-    int fracLen = (int)strlen(frac);
-
-    display.setTextSize(2);
-
-    int16_t w_left  = textWidthPx(left);
-    int16_t w_point = textWidthPx(point);
-
-    // ---- kHz oder MHz? anhand Nachkommastellenlänge entscheiden ----
-    // kHz3 => fracLen==3, MHz6 => fracLen==6
-    if (fracLen == 3) {
-      // kHz: value = "<kHz>.<hhh>"
-      // idx: 0=1MHz,1=100kHz,2=1kHz,3=100Hz,4=1Hz
-
-      int L = (int)leftLen;
-
-      // idx0: MHz-Teil = left ohne letzte 3 Stellen (falls vorhanden)
-      if (s.tuneCursor == 0) {
-        int split = L - 3;
-        if (split > 0) {
-          char mhzPart[16] = {0};
-          memcpy(mhzPart, left, (size_t)split);
-          mhzPart[split] = 0;
-          int16_t w_mhz = textWidthPx(mhzPart);
-          underlineRange(x, y, w_mhz);
-        } else {
-          // unter 1 MHz: underline ganzen Integerteil
-          underlineRange(x, y, w_left);
-        }
-      }
-      // idx1: 100kHz-Ziffer (3. von rechts) -> position L-3
-      else if (s.tuneCursor == 1) {
-        int pos = L - 3;
-        if (pos >= 0 && pos < L) {
-          char pre[16] = {0};
-          memcpy(pre, left, (size_t)pos);
-          pre[pos] = 0;
-
-          char dig[2] = { left[pos], 0 };
-
-          int16_t w_pre = textWidthPx(pre);
-          int16_t w_dig = textWidthPx(dig);
-
-          underlineRange(x + w_pre, y, w_dig);
-        }
-      }
-      // idx2: 1kHz-Ziffer (letzte) -> position L-1
-      else if (s.tuneCursor == 2) {
-        int pos = L - 1;
-        if (pos >= 0 && pos < L) {
-          char pre[16] = {0};
-          memcpy(pre, left, (size_t)pos);
-          pre[pos] = 0;
-
-          char dig[2] = { left[pos], 0 };
-
-          int16_t w_pre = textWidthPx(pre);
-          int16_t w_dig = textWidthPx(dig);
-
-          underlineRange(x + w_pre, y, w_dig);
-        }
-      }
-      // idx3: 100Hz = 1. Nachkommastelle
-      else if (s.tuneCursor == 3) {
-        char d0[2] = { frac[0], 0 };
-        int16_t w_d0 = textWidthPx(d0);
-        underlineRange(x + w_left + w_point, y, w_d0);
-      }
-      // idx4: 1Hz = 3. Nachkommastelle
-      else if (s.tuneCursor == 4) {
-        char d0[2] = { frac[0], 0 };
-        char d1[2] = { frac[1], 0 };
-        char d2[2] = { frac[2], 0 };
-
-        int16_t w_d0 = textWidthPx(d0);
-        int16_t w_d1 = textWidthPx(d1);
-        int16_t w_d2 = textWidthPx(d2);
-
-        underlineRange(x + w_left + w_point + w_d0 + w_d1, y, w_d2);
-      }
-    }
-    else if (fracLen == 6) {
-      // MHz: value = "<MHz>.<ffffff>"
-      // idx: 0=1MHz,1=100kHz,2=1kHz,3=100Hz,4=1Hz
-
-      if (s.tuneCursor == 0) {
-        underlineRange(x, y, w_left);
-      } else {
-        // welcher Nachkommastellen-Index?
-        int fracIndex = -1;
-        if (s.tuneCursor == 1) fracIndex = 0; // 100kHz
-        if (s.tuneCursor == 2) fracIndex = 2; // 1kHz
-        if (s.tuneCursor == 3) fracIndex = 3; // 100Hz
-        if (s.tuneCursor == 4) fracIndex = 5; // 1Hz
-
-        if (fracIndex >= 0 && fracIndex < fracLen) {
-          // Breite der Nachkommastellen bis zur Zielstelle aufsummieren
-          int16_t w_preFrac = 0;
-          for (int i = 0; i < fracIndex; i++) {
-            char di[2] = { frac[i], 0 };
-            w_preFrac += textWidthPx(di);
-          }
-          char target[2] = { frac[fracIndex], 0 };
-          int16_t w_target = textWidthPx(target);
-
-          underlineRange(x + w_left + w_point + w_preFrac, y, w_target);
-        }
-      }
+    const char* dot = strchr(value, '.');
+    int first, count;
+    if (dot && tuneCursorSpan(s.tuneCursor, unit, (int)(dot - value), first, count)) {
+      underlineRange(x + digitFontWidth(first), y, digitFontWidth(count));
     }
   }
 }
 
 
-}
-
-
 static void drawFooterMenu(const UiState& s) {
   int yTop = OLED_H - UI_FOOTER_H;
-  display.drawLine(0, yTop, OLED_W - 1, yTop, SH110X_WHITE);
-
   display.setTextSize(1);
 
   uint8_t n = s.menu_count;
@@ -374,49 +302,219 @@ static void drawFooterMenu(const UiState& s) {
   }
 }
 
+// Trennlinien unter dem Header und über dem Footer – ändern sich nie
+static void drawChrome(const UiState&) {
+  display.drawFastHLine(0, UI_HEADER_H - 1, OLED_W, SH110X_WHITE);
+  display.drawFastHLine(0, OLED_H - UI_FOOTER_H, OLED_W, SH110X_WHITE);
+}
+
+// ---------- Layer-Compositor ----------
+// Jeder Layer belegt waagrechte Bänder über die volle Breite (logische
+// Zeilen, disjunkt, zusammen der ganze Bildschirm). Bei OLED_ROTATION 3 ist
+// logische Zeile y die Display-Spalte y: ein Band ist in jeder Page ein
+// zusammenhängender Spaltenbereich und lässt sich per memcpy sichern und
+// zurückschreiben. Gezeichnet wird nur in die eigenen Bänder.
+static_assert(OLED_ROTATION == 3, "Layer-Bänder setzen Rotation 3 voraus");
+
+struct LayerBand {
+  int16_t y0, y1;   // inklusiv
+};
+
+struct LayerDef {
+  void (*draw)(const UiState&);
+  LayerBand band[2];
+  uint8_t bands;
+};
+
+static constexpr int16_t FOOTER_TOP = OLED_H - UI_FOOTER_H;
+static constexpr int16_t MARKER_END = UI_HEADER_H + 11;   // Textzeile bei UI_HEADER_H + 2
+
+// Reihenfolge wie DisplayLayer
+static const LayerDef LAYERS[(uint8_t)DisplayLayer::COUNT] = {
+  { drawChrome,     { { UI_HEADER_H - 1, UI_HEADER_H - 1 }, { FOOTER_TOP, FOOTER_TOP } }, 2 },
+  { drawHeader,     { { 0, UI_HEADER_H - 2 } }, 1 },
+  { drawTuneMarker, { { UI_HEADER_H, MARKER_END } }, 1 },
+  { drawFrequency,  { { MARKER_END + 1, FOOTER_TOP - 1 } }, 1 },
+  { drawFooterMenu, { { FOOTER_TOP + 1, OLED_H - 1 } }, 1 },
+};
+
+static constexpr uint8_t PAGES = OLED_H / 8;
+
+// Gerenderte Bänder im Display-Format; Bänder decken jede Zeile genau einmal ab
+static uint8_t layerCache[OLED_W * PAGES];
+static uint16_t layerDrawn[(uint8_t)DisplayLayer::COUNT];   // Version im Cache
+static bool recompose = true;   // Frame-Puffer aus dem Cache neu aufbauen
+static uint8_t lastLayers = 0;
+static uint32_t frameVersion = 0;
+
+// Fertiger Frame für Leser außerhalb von loop() (Web-Spiegel): der
+// Frame-Puffer selbst wird in composeFrame() bandweise gelöscht und neu
+// gezeichnet, die Kopie wechselt nur als Ganzes
+static uint8_t publishedFrame[OLED_W * PAGES];
+static uint32_t publishedVersion = 0;
+static portMUX_TYPE publishMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void publishFrame() {
+  portENTER_CRITICAL(&publishMux);
+  memcpy(publishedFrame, display.getBuffer(), sizeof(publishedFrame));
+  publishedVersion = frameVersion;
+  portEXIT_CRITICAL(&publishMux);
+}
+
+// Band <-> Cache; der Cache ist wie der Frame-Puffer organisiert
+static void bandCopy(const LayerBand& b, bool toCache) {
+  uint8_t* fb = display.getBuffer();
+  const size_t n = (size_t)(b.y1 - b.y0 + 1);
+  for (uint8_t p = 0; p < PAGES; p++) {
+    size_t off = (size_t)p * OLED_W + b.y0;
+    if (toCache) memcpy(layerCache + off, fb + off, n);
+    else         memcpy(fb + off, layerCache + off, n);
+  }
+}
+
+static void bandClear(const LayerBand& b) {
+  uint8_t* fb = display.getBuffer();
+  const size_t n = (size_t)(b.y1 - b.y0 + 1);
+  for (uint8_t p = 0; p < PAGES; p++) memset(fb + (size_t)p * OLED_W + b.y0, 0, n);
+}
+
+// Geänderte Layer neu zeichnen, unveränderte bleiben im Frame-Puffer stehen
+// (oder kommen nach recompose aus dem Cache). Rückgabe: Bitmaske neu gezeichneter Layer.
+static uint8_t composeFrame() {
+  uint8_t redrawn = 0;
+  app_state_snapshot(frameState);
+  for (uint8_t i = 0; i < (uint8_t)DisplayLayer::COUNT; i++) {
+    const LayerDef& l = LAYERS[i];
+    if (layerDrawn[i] != layerVersion[i]) {
+      for (uint8_t b = 0; b < l.bands; b++) bandClear(l.band[b]);
+      l.draw(ui);
+      for (uint8_t b = 0; b < l.bands; b++) bandCopy(l.band[b], true);
+      layerDrawn[i] = layerVersion[i];
+      redrawn |= (uint8_t)(1u << i);
+    } else if (recompose) {
+      for (uint8_t b = 0; b < l.bands; b++) bandCopy(l.band[b], false);
+    }
+  }
+  recompose = false;
+  return redrawn;
+}
+
+// AppBus-Handler: nur die betroffenen Layer markieren
+static FreqUnit shownUnit = FreqUnit::KHZ;
+static bool shownConfirmed = true;
+static uint32_t shownHz = 0;
+
+void DisplayEvents::on(const FrequencyChanged& e) {
+  // Einheit und "~" (unbestätigt) stehen in der Marker-Zeile, nur bei
+  // Wechsel neu zeichnen
+  FreqUnit u = freqUnitFor(e.hz);
+  if (u != shownUnit || e.confirmed != shownConfirmed) {
+    shownUnit = u;
+    shownConfirmed = e.confirmed;
+    markLayer(DisplayLayer::Marker);
+  }
+  // Nur Bestätigung/Radiowert geändert -> Ziffern bleiben
+  if (e.hz != shownHz) {
+    shownHz = e.hz;
+    markLayer(DisplayLayer::Frequency);
+  }
+}
+
+void DisplayEvents::on(const ModeChanged&) {
+  markLayer(DisplayLayer::Header);
+}
+
+void DisplayEvents::on(const LinkStateChanged&) {
+  markLayer(DisplayLayer::Header);
+}
+
+void DisplayEvents::on(const InputEvent& e) {
+  if (e.steps != 0) displayNoteInput(e.velocity, e.link_load_pct);
+}
+
 // ---------- Public API ----------
 bool displayInit() {
+  display.prepareBus();   // Wire-Puffer für ganze Pages, vor Wire.begin()
   Wire.begin(OLED_SDA, OLED_SCL);
 
-  if (!display.begin(OLED_ADDR, true)) { // true = reset (soft)
+  if (!display.begin(OLED_ADDR, OLED_I2C_HZ)) {
     return false;
   }
+  if (RADIO_DEBUG_MIRROR && display.clock() != OLED_I2C_HZ) {
+    Serial.printf("[OLED] I2C %lu Hz not acked, using %lu Hz\n",
+                  (unsigned long)OLED_I2C_HZ, (unsigned long)display.clock());
+  }
   display.setRotation(OLED_ROTATION);  // 90° im Uhrzeigersinn
 
   display.clearDisplay();
-  display.display();
+  display.invalidate();
+  display.display();     // einmal komplett, danach nur Änderungen
+  recompose = true;
+
+  AppState s;
+  app_state_snapshot(s);
+  shownUnit = freqUnitFor(s.freq_hz);
+  shownConfirmed = app_state_freq_confirmed(s);
+  shownHz = s.freq_hz;
+
+  if (DISPLAY_ASYNC_FLUSH &&
+      !display.startAsync(DISPLAY_FLUSH_CORE, DISPLAY_FLUSH_PRIO, DISPLAY_FLUSH_STACK)) {
+    if (RADIO_DEBUG_MIRROR) Serial.println("[OLED] flush task failed, using sync flush");
+  }
   return true;
 }
 
-void displaySetConnected(bool connected) {
-  if (ui.connected == connected) return;
-  ui.connected = connected;
-  markDirty();
+DisplayFlushStats displayFlushStats() {
+  DisplayFlushStats s = display.flushStats();
+  s.last_render_us = lastRenderUs;
+  s.max_render_us = maxRenderUs;
+  s.last_layers = lastLayers;
+  s.render_us = renderHist;
+  s.coalesced = coalesced;
+  s.stale_refreshes = staleRefreshes;
+  s.fps_x10 = fpsX10;
+  s.load_permille = loadPermille;
+  s.frame_interval_ms = frameIntervalMs;
+  s.paced = pacedFrames;
+  s.settle_frames = settleFrames;
+  return s;
 }
 
-void displaySetMode(RadioMode mode) {
-  if (RADIO_DEBUG_MIRROR) {
-    Serial.print("[dislpaySetMode]->");
-    Serial.println(radio_mode_to_string(global_radio_state.mode));
-  }
-  if (ui.mode == mode) return;
-  if (RADIO_DEBUG_MIRROR){
-    Serial.println("[displaySetMode][markDirty]");
-  }
-  ui.mode = mode;
-  markDirty();
+void displayResetStats() {
+  display.resetStats();
+  maxRenderUs = 0;
+  renderHist = DisplayHistogram();
+  coalesced = 0;
+  staleRefreshes = 0;
+  pacedFrames = 0;
+  settleFrames = 0;
 }
 
-void displaySetFrequencyHz(uint32_t hz) {
-  if (ui.freq_hz == hz) return;
-  ui.freq_hz = hz;
-  markDirty();
+DisplayBusBench displayBusBench() {
+  return display.bench();
+}
+
+const uint8_t* displayFramebuffer() {
+  return display.getBuffer();
+}
+
+uint32_t displayFrameVersion() {
+  return frameVersion;
+}
+
+uint32_t displayFrameCopy(uint8_t* dst) {
+  portENTER_CRITICAL(&publishMux);
+  memcpy(dst, publishedFrame, sizeof(publishedFrame));
+  uint32_t v = publishedVersion;
+  portEXIT_CRITICAL(&publishMux);
+  return v;
 }
 
 void displaySetTuneMarker(bool on) {
   if (ui.tuneMarker == on) return;
   ui.tuneMarker = on;
-  markDirty();
+  markLayer(DisplayLayer::Marker);
+  markLayer(DisplayLayer::Frequency);
 }
 
 
@@ -438,7 +536,7 @@ void displaySetMenuLabels(const char* const* labels, uint8_t count) {
     changed = true;
   }
 
-  if (changed) markDirty();
+  if (changed) markLayer(DisplayLayer::Footer);
 }
 
 void displaySetMenuIndex(uint8_t index) {
@@ -446,50 +544,116 @@ void displaySetMenuIndex(uint8_t index) {
   index %= ui.menu_count;
   if (ui.menu_index == index) return;
   ui.menu_index = index;
-  markDirty();
+  markLayer(DisplayLayer::Footer);
 }
 
 uint8_t displayGetMenuIndex() {
   return ui.menu_index;
 }
 
-void displayRender() {
-  display.clearDisplay();
-
-  drawHeader(ui);
-  drawTuneMarker(ui);
-  drawFrequency(ui);     // bzw. drawFrequency__ bei dir
-  drawFooterMenu(ui);
+// Latenz: Frame mit einer neuen freq_seq ist auf dem Panel angekommen
+static uint16_t shownFrameTag = 0;
 
-  display.display();
+static void noteShownFrame() {
+  uint32_t us;
+  uint16_t tag = display.shownTag(us);
+  if (tag == shownFrameTag) return;
+  shownFrameTag = tag;
+  latency_mark_frame(tag, us);
+}
 
+void displayRender() {
+  uint32_t t0 = micros();
+  lastLayers = composeFrame();
+  if (lastLayers) {
+    frameVersion++;
+    publishFrame();
+  }
+  pacedPending = false;
+  display.display(frameState.freq_seq);     // async: nur Übergabe an die Flush-Task
+  noteShownFrame();                         // synchron schon übertragen
+
+  lastRenderUs = micros() - t0;
+  if (lastRenderUs > maxRenderUs) maxRenderUs = lastRenderUs;
+  renderHist.add(lastRenderUs);
+  winFrames++;
+  winRenderUs += lastRenderUs;
   uiDirty = false;
   lastRenderMs = millis();
 }
 
 
+// fps und loop()-Anteil über volle Sekundenfenster
+static void rollMetricsWindow(uint32_t now) {
+  uint32_t elapsed = now - winStartMs;
+  if (elapsed < 1000) return;
+  fpsX10 = (uint16_t)(winFrames * 10000UL / elapsed);
+  loadPermille = (uint16_t)(winRenderUs / elapsed);   // us / ms = Promille
+  winStartMs = now;
+  winFrames = 0;
+  winRenderUs = 0;
+}
+
+void displayNoteInput(uint16_t detentsPerSec, uint8_t loadPct) {
+  lastInputMs = millis();
+  inputVelocity = detentsPerSec;
+  linkLoadPct = loadPct;
+  spinning = true;
+}
+
+// Mindestabstand zwischen Frames: wächst mit der Drehgeschwindigkeit und
+// verdoppelt sich, wenn die Radio-Queue voll läuft – dann zählt loop()-Zeit
+// für Encoder und Link mehr als jeder Zwischenwert auf dem Display.
+static uint16_t paceIntervalMs() {
+  uint32_t ms = UI_MIN_REFRESH_MS;
+  if (inputVelocity > UI_PACE_VELOCITY_MIN) {
+    ms += (uint32_t)(inputVelocity - UI_PACE_VELOCITY_MIN) * UI_PACE_MS_PER_DETENT;
+  }
+  if (linkLoadPct >= UI_PACE_LINK_LOAD_PCT) ms *= 2;
+  return (uint16_t)(ms < UI_PACE_MAX_MS ? ms : UI_PACE_MAX_MS);
+}
+
 void displayTick() {
   uint32_t now = millis();
-  if (uiDirty && (now - lastRenderMs >= UI_MIN_REFRESH_MS)) {
+  rollMetricsWindow(now);
+  noteShownFrame();
+
+  if (spinning && now - lastInputMs >= UI_PACE_SETTLE_MS) {
+    // Drehen vorbei: Endwert sofort zeigen (Refresh-Limit gilt weiter)
+    spinning = false;
+    frameIntervalMs = UI_MIN_REFRESH_MS;
+    if (uiDirty && now - lastRenderMs >= UI_MIN_REFRESH_MS) {
+      settleFrames++;
+      displayRender();
+      return;
+    }
+  }
+  if (spinning) frameIntervalMs = paceIntervalMs();
+
+  if (!uiDirty) return;
+  if (now - lastRenderMs >= frameIntervalMs) {
     displayRender();
-    uiDirty = false;
-    lastRenderMs = now;
+  } else if (!pacedPending && now - lastRenderMs >= UI_MIN_REFRESH_MS) {
+    pacedPending = true;   // ohne Pacing wäre jetzt gezeichnet worden
+    pacedFrames++;
   }
 }
 
-static constexpr uint32_t UI_MAX_STALE_MS = 3000;
-
 void displayTickPeriodic() {
   uint32_t now = millis();
-
-  bool stale = (now - lastRenderMs) > UI_MAX_STALE_MS;
-
-  if ((uiDirty || stale) && (now - lastRenderMs >= UI_MIN_REFRESH_MS)) {
+  if (now - lastRenderMs > UI_MAX_STALE_MS) {
+    // lange nichts gezeichnet: Panel komplett neu beschreiben
+    staleRefreshes++;
+    display.invalidate();
     displayRender();
+    return;
   }
+  displayTick();
 }
 
 void displayForceRefresh() {
-  markDirty();
+  for (uint8_t i = 0; i < (uint8_t)DisplayLayer::COUNT; i++) layerVersion[i]++;
+  uiDirty = true;
+  display.invalidate();
 }
 
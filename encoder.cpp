@@ -4,27 +4,93 @@
 #include "config_display.h"
 #include "display.h"
 
+#include <atomic>
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
+
+// ---- Event-Queue ISR -> loop() ----
+// Die ISRs schieben Quadratur-Ticks und Button-Flanken mit micros()-Zeitstempel
+// in einen Ring; encoderPoll() wertet sie in Reihenfolge aus. Alle GPIO-ISRs
+// laufen über denselben GPIO-Interrupt auf einem Kern und unterbrechen sich
+// nicht gegenseitig -> genau ein Producer, loop() ist der einzige Consumer.
+// Damit braucht es weder noInterrupts() noch Locks.
+enum class EncRawKind : uint8_t { Tick, Button };
+
+struct EncRawEvent {
+  uint32_t us;
+  EncRawKind kind;
+  int8_t value;     // Tick: -1/+1, Button: Pegel (0 = gedrückt)
+};
+
+static_assert((ENC_EVENT_QUEUE_LEN & (ENC_EVENT_QUEUE_LEN - 1)) == 0, "ENC_EVENT_QUEUE_LEN muss 2^n sein");
+
+static EncRawEvent g_ring[ENC_EVENT_QUEUE_LEN];
+static std::atomic<uint16_t> g_head{0};   // nur ISR schreibt
+static std::atomic<uint16_t> g_tail{0};   // nur loop() schreibt
+
+// Ring voll (loop() hängt sehr lange): Ticks ohne Zeitstempel weiterzählen,
+// damit keine Rastung verloren geht
+static std::atomic<int32_t> g_overflowTicks{0};
+static std::atomic<uint32_t> g_overflowEvents{0};
+
+static EncoderStats g_stats;
+
 // ---- Quadrature Decode (Interrupt) ----
 // Zustandsmaschine (Gray code)
-static volatile int16_t g_delta = 0;
 static volatile uint8_t g_lastAB = 0;
 
-// Button
-static bool g_btnLast = true; // pullup => true = nicht gedrückt
-static uint32_t g_btnDownMs = 0;
-static EncButtonEvent g_btnEvent = EncButtonEvent::None;
+// Geschwindigkeit (Rastungen pro Sekunde, geglättet)
+static uint32_t g_lastDetentUs = 0;
+static uint16_t g_velocity = 0;
+static int8_t g_lastDir = 0;
+
+// Button (Entprellung im Consumer, über die Zeitstempel der Flanken)
+static uint8_t g_btnStable = 1;       // pullup => 1 = nicht gedrückt
+static uint8_t g_btnRaw = 1;          // letzter gemeldeter Pegel
+static uint32_t g_btnRawUs = 0;       // seit wann
+static uint32_t g_btnDownUs = 0;
+static volatile uint8_t g_btnIsrLevel = 1;
+
+// Fertige Klicks, falls mehrere zwischen zwei encoderPoll() liegen
+static EncButtonEvent g_btnQueue[4];
+static uint32_t g_btnQueueUs[4];      // ISR-Zeitstempel der Loslass-Flanke
+static uint8_t g_btnQueueHead = 0;
+static uint8_t g_btnQueueCount = 0;
 
 // Debounce/Longpress
-static constexpr uint32_t BTN_DEBOUNCE_MS  = ENC_BTN_DEBOUNCE_MS;
-static constexpr uint32_t BTN_LONGPRESS_MS = ENC_BTN_LONGPRESS_MS;
+static constexpr uint32_t BTN_DEBOUNCE_US  = ENC_BTN_DEBOUNCE_MS * 1000UL;
+static constexpr uint32_t BTN_LONGPRESS_US = ENC_BTN_LONGPRESS_MS * 1000UL;
 
+// ---- GPIO direkt aus dem Input-Register ----
+// GPIO 0..31 in GPIO_IN_REG, 32..39 in GPIO_IN1_REG. Liegen A und B in
+// derselben Bank (Standard: 32/33), reicht ein einziger Registerzugriff.
+static inline uint32_t IRAM_ATTR gpioBank(uint8_t pin) {
+  return pin < 32 ? REG_READ(GPIO_IN_REG) : REG_READ(GPIO_IN1_REG);
+}
 
-static uint32_t g_btnLastChangeMs = 0;
+static inline uint8_t IRAM_ATTR gpioBit(uint32_t bank, uint8_t pin) {
+  return (uint8_t)((bank >> (pin & 31)) & 1U);
+}
 
-static inline uint8_t readAB() {
-  uint8_t a = (uint8_t)digitalRead(ENC_A);
-  uint8_t b = (uint8_t)digitalRead(ENC_B);
-  return (a << 1) | b;
+static inline uint8_t IRAM_ATTR readAB() {
+  uint32_t a = gpioBank(ENC_A);
+  uint32_t b = ((ENC_A < 32) == (ENC_B < 32)) ? a : gpioBank(ENC_B);
+  return (uint8_t)((gpioBit(a, ENC_A) << 1) | gpioBit(b, ENC_B));
+}
+
+static inline void IRAM_ATTR pushEvent(EncRawKind kind, int8_t value) {
+  uint16_t h = g_head.load(std::memory_order_relaxed);
+  uint16_t t = g_tail.load(std::memory_order_acquire);
+  if ((uint16_t)(h - t) >= ENC_EVENT_QUEUE_LEN) {
+    if (kind == EncRawKind::Tick) g_overflowTicks.fetch_add(value, std::memory_order_relaxed);
+    g_overflowEvents.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  EncRawEvent& e = g_ring[h & (ENC_EVENT_QUEUE_LEN - 1)];
+  e.us = micros();
+  e.kind = kind;
+  e.value = value;
+  g_head.store((uint16_t)(h + 1), std::memory_order_release);
 }
 
 // Lookup: Übergänge -> -1/0/+1
@@ -42,9 +108,14 @@ static void IRAM_ATTR isrEnc() {
   int8_t step = TRANSITION_TABLE[idx];
   g_lastAB = ab;
 
-  if (step != 0) {
-    g_delta += step;
-  }
+  if (step != 0) pushEvent(EncRawKind::Tick, step);
+}
+
+static void IRAM_ATTR isrBtn() {
+  uint8_t level = gpioBit(gpioBank(ENC_BTN), ENC_BTN);
+  if (level == g_btnIsrLevel) return;   // Doppel-Interrupt ohne Pegelwechsel
+  g_btnIsrLevel = level;
+  pushEvent(EncRawKind::Button, (int8_t)level);
 }
 
 void encoderInit() {
@@ -53,47 +124,84 @@ void encoderInit() {
   pinMode(ENC_BTN, INPUT_PULLUP);
 
   g_lastAB = readAB();
+  g_btnIsrLevel = gpioBit(gpioBank(ENC_BTN), ENC_BTN);
+  g_btnStable = g_btnRaw = g_btnIsrLevel;
 
   // Beide Kanäle triggern
   attachInterrupt(digitalPinToInterrupt(ENC_A), isrEnc, CHANGE);
   attachInterrupt(digitalPinToInterrupt(ENC_B), isrEnc, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(ENC_BTN), isrBtn, CHANGE);
+}
+
+uint16_t encoderAccelFactor(uint16_t v) {
+  if (!ENC_ACCEL_ENABLED) return 1;
+  for (uint8_t i = 1; i < ENC_ACCEL_POINTS; i++) {
+    const EncAccelPoint& hi = ENC_ACCEL_CURVE[i];
+    if (v >= hi.detents_per_s) continue;
+    const EncAccelPoint& lo = ENC_ACCEL_CURVE[i - 1];
+    uint32_t span = hi.detents_per_s - lo.detents_per_s;
+    uint32_t f = lo.factor + (uint32_t)(hi.factor - lo.factor) * (v - lo.detents_per_s) / span;
+    return (uint16_t)f;
+  }
+  return ENC_ACCEL_CURVE[ENC_ACCEL_POINTS - 1].factor;
 }
 
-int16_t encoderGetAndClearDelta() {
-  noInterrupts();
-  int16_t d = g_delta;
-  g_delta = 0;
-  interrupts();
+// Geschwindigkeit aus dem Abstand zur vorigen Rastung, beide mit dem
+// Zeitstempel aus der ISR – ein hängendes loop() verfälscht sie nicht.
+// Richtungswechsel und Pausen setzen auf 0 zurück -> wieder Einzelschritte.
+static void updateVelocity(int8_t dir, uint32_t us) {
+  uint32_t dt = us - g_lastDetentUs;
+  bool fresh = g_lastDetentUs != 0 && dir == g_lastDir && dt / 1000UL < ENC_VELOCITY_IDLE_MS;
+  g_lastDetentUs = us;
+  g_lastDir = dir;
 
-  // Viele Encoder liefern 4 Counts pro Rastung.
-  // Wenn du 1 "Klick" pro Rastung willst, teile durch 4.
-  // Lass es erstmal "roh" und entscheide später.
-  return d;
+  if (!fresh || dt == 0) {
+    g_velocity = 0;
+    return;
+  }
+
+  uint32_t inst = 1000000UL / dt;
+  if (inst > 1000) inst = 1000;
+  g_velocity = (uint16_t)((g_velocity * (uint32_t)(ENC_VELOCITY_SMOOTH - 1) + inst) / ENC_VELOCITY_SMOOTH);
 }
 
-EncButtonEvent encoderGetButtonEvent() {
-  // Polling mit Debounce
-  bool now = digitalRead(ENC_BTN); // pullup: true = offen, false = gedrückt
-  uint32_t t = millis();
+static void queueButton(EncButtonEvent e, uint32_t us) {
+  if (g_btnQueueCount >= sizeof(g_btnQueue) / sizeof(g_btnQueue[0])) {
+    g_stats.buttons_dropped++;
+    return;
+  }
+  g_btnQueue[(g_btnQueueHead + g_btnQueueCount) % 4] = e;
+  g_btnQueueUs[(g_btnQueueHead + g_btnQueueCount) % 4] = us;
+  g_btnQueueCount++;
+}
 
-  if (now != g_btnLast && (t - g_btnLastChangeMs) > BTN_DEBOUNCE_MS) {
-    g_btnLastChangeMs = t;
-    g_btnLast = now;
+// Pegel g_btnRaw steht seit g_btnRawUs -> nach Entprellzeit übernehmen
+static void commitButton(uint32_t nowUs) {
+  if (g_btnRaw == g_btnStable) return;
+  if (nowUs - g_btnRawUs < BTN_DEBOUNCE_US) return;
 
-    if (!now) {
-      // gedrückt
-      g_btnDownMs = t;
-    } else {
-      // losgelassen
-      uint32_t held = t - g_btnDownMs;
-      if (held >= BTN_LONGPRESS_MS) g_btnEvent = EncButtonEvent::LongPress;
-      else g_btnEvent = EncButtonEvent::Click;
-    }
+  g_btnStable = g_btnRaw;
+  if (!g_btnStable) {
+    // gedrückt
+    g_btnDownUs = g_btnRawUs;
+  } else {
+    // losgelassen
+    uint32_t held = g_btnRawUs - g_btnDownUs;
+    queueButton(held >= BTN_LONGPRESS_US ? EncButtonEvent::LongPress : EncButtonEvent::Click, g_btnRawUs);
   }
+}
 
-  EncButtonEvent e = g_btnEvent;
-  g_btnEvent = EncButtonEvent::None;
-  return e;
+static void onButtonEdge(uint8_t level, uint32_t us) {
+  // Vorheriger Pegel hat bis zu dieser Flanke lange genug gehalten?
+  commitButton(us);
+  g_btnRaw = level;
+  g_btnRawUs = us;
+}
+
+EncoderStats encoderStats() {
+  EncoderStats s = g_stats;
+  s.overflow_events = g_overflowEvents.load(std::memory_order_relaxed);
+  return s;
 }
 
 EncoderEvent encoderPoll() {
@@ -101,21 +209,74 @@ EncoderEvent encoderPoll() {
   e.steps = 0;
   e.button = EncButtonEvent::None;
 
-  // ---- Drehung ----
-  int16_t delta = encoderGetAndClearDelta();
+  // ---- Events abarbeiten ----
   static int16_t acc = 0;
-  acc += delta;
+  int32_t accelSteps = 0;
 
-  while (acc >= ENC_TICKS_PER_DETENT) {
-    acc -= ENC_TICKS_PER_DETENT;
-    e.steps++;
+  uint16_t t = g_tail.load(std::memory_order_relaxed);
+  uint16_t h = g_head.load(std::memory_order_acquire);
+  uint16_t depth = (uint16_t)(h - t);
+  if (depth > g_stats.max_depth) g_stats.max_depth = depth;
+
+  while (t != h) {
+    const EncRawEvent& ev = g_ring[t & (ENC_EVENT_QUEUE_LEN - 1)];
+    // steps ist int8_t: Rest bleibt im Ring für den nächsten Poll
+    if (ev.kind == EncRawKind::Tick && (e.steps >= INT8_MAX - 1 || e.steps <= INT8_MIN + 1)) break;
+    g_stats.events++;
+
+    if (ev.kind == EncRawKind::Tick) {
+      acc += ev.value;
+      // Rastung komplett: mit dem Zeitstempel dieses Ticks
+      int8_t dir = 0;
+      if (acc >= ENC_TICKS_PER_DETENT) { acc -= ENC_TICKS_PER_DETENT; dir = 1; }
+      else if (acc <= -ENC_TICKS_PER_DETENT) { acc += ENC_TICKS_PER_DETENT; dir = -1; }
+      if (dir) {
+        updateVelocity(dir, ev.us);
+        if (e.steps == 0 && !e.t_us) e.t_us = ev.us ? ev.us : 1;
+        e.steps += dir;
+        accelSteps += (int32_t)dir * encoderAccelFactor(g_velocity);
+      }
+    } else {
+      onButtonEdge((uint8_t)ev.value, ev.us);
+    }
+    t++;
+  }
+  g_tail.store(t, std::memory_order_release);
+
+  // Überlauf: Ticks ohne Zeitstempel, zählen als Einzelschritte.
+  // Verlorene Button-Flanken: Pegel aus der ISR übernehmen.
+  static uint32_t seenOverflows = 0;
+  uint32_t overflows = g_overflowEvents.load(std::memory_order_relaxed);
+  if (overflows != seenOverflows && t == g_head.load(std::memory_order_acquire)) {
+    seenOverflows = overflows;
+    uint8_t lvl = g_btnIsrLevel;
+    if (lvl != g_btnRaw) onButtonEdge(lvl, micros());
   }
-  while (acc <= -ENC_TICKS_PER_DETENT) {
-    acc += ENC_TICKS_PER_DETENT;
-    e.steps--;
+  int32_t lost = g_overflowTicks.exchange(0, std::memory_order_relaxed);
+  if (lost) {
+    // wie beim Ring: steps nur bis zur int8_t-Grenze, ganze Rastungen
+    // darüber hinaus gehen zurück an g_overflowTicks für den nächsten Poll
+    int32_t ticks = (int32_t)acc + lost;
+    while (ticks >= ENC_TICKS_PER_DETENT && e.steps < INT8_MAX)  { ticks -= ENC_TICKS_PER_DETENT; e.steps++; accelSteps++; }
+    while (ticks <= -ENC_TICKS_PER_DETENT && e.steps > INT8_MIN) { ticks += ENC_TICKS_PER_DETENT; e.steps--; accelSteps--; }
+    int32_t rest = ticks % ENC_TICKS_PER_DETENT;   // Bruchteil einer Rastung
+    acc = (int16_t)rest;
+    if (ticks != rest) g_overflowTicks.fetch_add(ticks - rest, std::memory_order_relaxed);
   }
 
+  uint32_t nowUs = micros();
+  if (e.steps == 0 && g_velocity && (nowUs - g_lastDetentUs) / 1000UL >= ENC_VELOCITY_IDLE_MS) g_velocity = 0;
+
+  e.velocity = g_velocity;
+  e.accelSteps = accelSteps;
+
   // ---- Button ----
-  e.button = encoderGetButtonEvent();
+  commitButton(nowUs);
+  if (g_btnQueueCount) {
+    e.button = g_btnQueue[g_btnQueueHead];
+    if (!e.t_us) e.t_us = g_btnQueueUs[g_btnQueueHead] ? g_btnQueueUs[g_btnQueueHead] : 1;
+    g_btnQueueHead = (g_btnQueueHead + 1) % 4;
+    g_btnQueueCount--;
+  }
   return e;
-}
\ No newline at end of file
+}
@@ -6,7 +6,22 @@ enum class EncButtonEvent : uint8_t { None, Click, LongPress };
 struct EncoderEvent {
   int8_t steps;              // -n / +n (Rastungen, nicht raw ticks)
   EncButtonEvent button;     // Click/LongPress
+  uint16_t velocity;         // Rastungen/s (geglättet), 0 = Stillstand
+  int32_t accelSteps;        // steps * Beschleunigungsfaktor (Tuning)
+  uint32_t t_us;             // ISR-Zeitstempel: erste Rastung, sonst Loslassen der Taste; 0 = nichts
+};
+
+// Faktor der Beschleunigungskurve für eine Geschwindigkeit (encoder_config.h)
+uint16_t encoderAccelFactor(uint16_t detentsPerSec);
+
+// ISR -> loop() Event-Queue (Diagnose)
+struct EncoderStats {
+  uint32_t events = 0;            // verarbeitete Tick-/Button-Events
+  uint16_t max_depth = 0;         // höchster Füllstand beim Poll
+  uint32_t overflow_events = 0;   // Ring voll, nur gezählt (Ticks gehen nicht verloren)
+  uint32_t buttons_dropped = 0;   // mehr als 4 Klicks zwischen zwei Polls
 };
 
 void encoderInit();
 EncoderEvent encoderPoll();  // ersetzt encoder_loop()
+EncoderStats encoderStats();
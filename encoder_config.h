@@ -11,6 +11,41 @@ static constexpr uint8_t ENC_BTN = 25;   // SW
 // KY-040 meistens 4
 static constexpr int8_t ENC_TICKS_PER_DETENT = 4;
 
-// Button
+// -------- Beschleunigung --------
+// Drehgeschwindigkeit (Rastungen/s, geglättet) -> Faktor auf den Tuning-Schritt.
+// Zwischen den Stützpunkten wird linear interpoliert, darüber gilt der letzte.
+// Langsames Drehen bleibt bei Faktor 1 (Einzelschritt-Präzision).
+struct EncAccelPoint {
+  uint16_t detents_per_s;
+  uint16_t factor;
+};
+
+static constexpr EncAccelPoint ENC_ACCEL_CURVE[] = {
+  {  0,   1 },
+  {  8,   1 },   // bis ~8 Rastungen/s: exakt
+  { 15,   5 },
+  { 25,  20 },
+  { 40, 100 },   // schnelles Durchkurbeln: 1 kHz-Cursor -> 100 kHz pro Rastung
+};
+static constexpr uint8_t ENC_ACCEL_POINTS = sizeof(ENC_ACCEL_CURVE) / sizeof(ENC_ACCEL_CURVE[0]);
+
+// Größter beschleunigter Schritt pro Rastung. Die Kurve ist auf den 1 kHz-Cursor
+// ausgelegt; auf groben Cursors (100 kHz, 1 MHz) wirkt sie damit nicht, auf
+// feinen (100 Hz, 1 Hz) nur bis zu diesem Schritt. Faktor 1 bleibt immer möglich.
+static constexpr uint32_t ENC_ACCEL_MAX_STEP_HZ = 100000;
+
+static constexpr bool     ENC_ACCEL_ENABLED  = true;
+static constexpr uint8_t  ENC_VELOCITY_SMOOTH = 2;   // gleitender Mittelwert: v = (v*(N-1) + neu) / N
+static constexpr uint32_t ENC_VELOCITY_IDLE_MS = 250; // so lange keine Rastung -> Geschwindigkeit 0
+
+// Frequenz an das Radio höchstens alle ENC_FREQ_SEND_MIN_MS schicken;
+// dazwischen gedrehte Rastungen werden zu einem Update zusammengefasst.
+static constexpr uint32_t ENC_FREQ_SEND_MIN_MS = 80;
+
+// Event-Ring ISR -> loop(), 2^n. Pro Rastung 4 Tick-Events:
+// 128 puffern 32 Rastungen, bevor nur noch gezählt wird.
+static constexpr uint16_t ENC_EVENT_QUEUE_LEN = 128;
+
+// Button (Interrupt, entprellt über die Flanken-Zeitstempel)
 static constexpr uint32_t ENC_BTN_DEBOUNCE_MS  = 25;
 static constexpr uint32_t ENC_BTN_LONGPRESS_MS = 600;
@@ -0,0 +1,58 @@
+#pragma once
+// Typisierter Publish/Subscribe-Bus, Empfänger stehen zur Compile-Zeit fest.
+//
+//   typedef EventBus<DisplayEvents, WebEvents> Bus;
+//   Bus::publish(FrequencyChanged{ 14074000, v });
+//
+// Ein Empfänger ist eine Klasse mit statischen Handlern
+//   static void on(const Event& e);
+// – nur für die Events, die ihn interessieren. publish() ruft für jeden
+// Empfänger mit passendem Handler genau diesen auf, in der Reihenfolge der
+// Template-Liste. Kein Heap, keine virtuellen Aufrufe, keine Tabelle zur
+// Laufzeit; der Event liegt als Referenz auf dem Stack des Senders.
+//
+// Handler laufen synchron im Kontext des Senders (wie ein Funktionsaufruf)
+// und sollen kurz bleiben: markieren, zählen, ausgeben – nicht selbst senden.
+
+#include <type_traits>
+#include <utility>
+
+namespace event_bus_detail {
+
+// Hat Sub einen Handler Sub::on(const E&)?
+template <typename Sub, typename E>
+class HasHandler {
+  template <typename T>
+  static auto test(int) -> decltype(T::on(std::declval<const E&>()), char());
+  template <typename>
+  static long test(...);
+public:
+  static constexpr bool value = sizeof(test<Sub>(0)) == sizeof(char);
+};
+
+template <typename Sub, typename E>
+inline void deliver(const E& e, std::true_type) { Sub::on(e); }
+
+template <typename Sub, typename E>
+inline void deliver(const E&, std::false_type) {}
+
+}  // namespace event_bus_detail
+
+template <typename... Subs>
+struct EventBus;
+
+template <>
+struct EventBus<> {
+  template <typename E>
+  static void publish(const E&) {}
+};
+
+template <typename Sub, typename... Rest>
+struct EventBus<Sub, Rest...> {
+  template <typename E>
+  static void publish(const E& e) {
+    event_bus_detail::deliver<Sub>(
+      e, std::integral_constant<bool, event_bus_detail::HasHandler<Sub, E>::value>());
+    EventBus<Rest...>::publish(e);
+  }
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+
+// Log2-Histogramm: Bucket 0 = 0, Bucket i = [2^(i-1), 2^i), letzter nach oben offen.
+// Feste Größe, add() ist ein clz – auch in Hot Paths und der Flush-Task billig.
+template <uint8_t N>
+struct Log2Histogram {
+  static constexpr uint8_t BUCKETS = N;
+  uint32_t count[BUCKETS] = {};
+
+  void add(uint32_t v) {
+    uint8_t b = v ? (uint8_t)(32 - __builtin_clz(v)) : 0;
+    count[b < BUCKETS ? b : BUCKETS - 1]++;
+  }
+
+  uint32_t total() const {
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) n += count[i];
+    return n;
+  }
+
+  // Obergrenze des Buckets, in dem das p-Perzentil liegt (0 = keine Werte)
+  uint32_t percentile(uint8_t p) const {
+    uint32_t n = total();
+    if (!n) return 0;
+    uint32_t want = (n * p + 99) / 100, seen = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+      seen += count[i];
+      if (seen >= want) return i ? (1UL << i) - 1 : 0;
+    }
+    return (1UL << (BUCKETS - 1)) - 1;
+  }
+};
@@ -0,0 +1,126 @@
+#include "latency_trace.h"
+#include "app_events.h"
+
+static LatencyHistogram hist[(uint8_t)LatencyOrigin::COUNT][(uint8_t)LatencyStage::COUNT];
+
+// Offene Traces: wenige reichen, ältere werden überschrieben
+struct Trace {
+  uint16_t seq;
+  LatencyOrigin origin;
+  uint8_t done;        // Bit je LatencyStage: schon erfasst
+  bool used;
+  uint32_t t0_us;
+  uint32_t send_us;
+  uint32_t tx_us;
+};
+
+static constexpr uint8_t TRACE_SLOTS = 8;
+static Trace traces[TRACE_SLOTS];
+static uint8_t traceNext = 0;
+
+static bool inputActive = false;
+static LatencyOrigin inputOrigin = LatencyOrigin::Encoder;
+static uint32_t inputT0 = 0;
+
+void latency_input_begin(LatencyOrigin o, uint32_t t0_us) {
+  inputActive = true;
+  inputOrigin = o;
+  inputT0 = t0_us;
+}
+
+void latency_input_end() {
+  inputActive = false;
+}
+
+void latency_record(LatencyOrigin o, LatencyStage s, uint32_t us) {
+  hist[(uint8_t)o][(uint8_t)s].add(us);
+}
+
+// Neue Wunschfrequenz während einer Eingabe -> Trace öffnen
+void LatencyEvents::on(const FrequencyChanged& e) {
+  if (!inputActive) return;
+  for (uint8_t i = 0; i < TRACE_SLOTS; i++) {
+    if (traces[i].used && traces[i].seq == e.seq) return;   // nur Bestätigung
+  }
+  Trace& t = traces[traceNext];
+  traceNext = (uint8_t)((traceNext + 1) % TRACE_SLOTS);
+  t = Trace();
+  t.used = true;
+  t.seq = e.seq;
+  t.origin = inputOrigin;
+  t.t0_us = inputT0;
+}
+
+static Trace* find(uint16_t seq) {
+  for (uint8_t i = 0; i < TRACE_SLOTS; i++) {
+    if (traces[i].used && traces[i].seq == seq) return &traces[i];
+  }
+  return nullptr;
+}
+
+// Stufe einmal je Trace erfassen
+static bool once(Trace* t, LatencyStage s) {
+  uint8_t bit = (uint8_t)(1u << (uint8_t)s);
+  if (!t || (t->done & bit)) return false;
+  t->done |= bit;
+  return true;
+}
+
+void latency_mark_sent(uint16_t seq, uint32_t t_us) {
+  Trace* t = find(seq);
+  if (!once(t, LatencyStage::InputToSend)) return;
+  t->send_us = t_us;
+  latency_record(t->origin, LatencyStage::InputToSend, t_us - t->t0_us);
+}
+
+void latency_mark_tx(uint16_t seq, uint32_t t_us) {
+  Trace* t = find(seq);
+  if (!once(t, LatencyStage::InputToTx)) return;
+  t->tx_us = t_us;
+  latency_record(t->origin, LatencyStage::InputToTx, t_us - t->t0_us);
+  if (once(t, LatencyStage::SendToTx) && t->send_us) {
+    latency_record(t->origin, LatencyStage::SendToTx, t_us - t->send_us);
+  }
+}
+
+void latency_mark_confirmed(uint16_t seq, uint32_t t_us) {
+  Trace* t = find(seq);
+  if (!t || !t->tx_us || !once(t, LatencyStage::TxToConfirm)) return;
+  latency_record(t->origin, LatencyStage::TxToConfirm, t_us - t->tx_us);
+}
+
+void latency_mark_frame(uint16_t seq, uint32_t t_us) {
+  Trace* t = find(seq);
+  if (!once(t, LatencyStage::InputToFrame)) return;
+  latency_record(t->origin, LatencyStage::InputToFrame, t_us - t->t0_us);
+}
+
+LatencyHistogram latency_histogram(LatencyOrigin o, LatencyStage s) {
+  return hist[(uint8_t)o][(uint8_t)s];
+}
+
+void latency_reset() {
+  for (uint8_t o = 0; o < (uint8_t)LatencyOrigin::COUNT; o++) {
+    for (uint8_t s = 0; s < (uint8_t)LatencyStage::COUNT; s++) hist[o][s] = LatencyHistogram();
+  }
+}
+
+const char* latency_origin_name(LatencyOrigin o) {
+  switch (o) {
+    case LatencyOrigin::Encoder: return "encoder";
+    case LatencyOrigin::Web:     return "web";
+    default:                     return "?";
+  }
+}
+
+const char* latency_stage_name(LatencyStage s) {
+  switch (s) {
+    case LatencyStage::IsrToPoll:    return "isr_to_poll";
+    case LatencyStage::InputToSend:  return "input_to_send";
+    case LatencyStage::SendToTx:     return "send_to_tx";
+    case LatencyStage::TxToConfirm:  return "tx_to_confirm";
+    case LatencyStage::InputToTx:    return "input_to_tx";
+    case LatencyStage::InputToFrame: return "input_to_frame";
+    default:                         return "?";
+  }
+}
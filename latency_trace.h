@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+#include "histogram.h"
+
+// Latenz von der Eingabe bis zum Radio und bis zum OLED, pro Stufe als
+// Histogramm (µs).
+//
+// Verfolgt wird die Frequenz: jede neue Wunschfrequenz (AppState::freq_seq)
+// bekommt den Zeitstempel ihrer Eingabe – beim Encoder den ISR-Zeitstempel
+// der Rastung, beim Web den Eingang des HTTP-Requests. Die weiteren Stufen
+// melden radio_link (angenommen, gesendet, bestätigt) und das Display
+// (Frame mit dieser freq_seq übertragen), jeweils mit derselben freq_seq.
+// Werte, die nie gesendet bzw. angezeigt werden (vom nächsten überholt),
+// tauchen in den späteren Stufen nicht auf.
+
+enum class LatencyOrigin : uint8_t { Encoder, Web, COUNT };
+
+enum class LatencyStage : uint8_t {
+  IsrToPoll,      // nur Encoder: ISR -> ui_handleEncoder()
+  InputToSend,    // Eingabe -> radio_send_freq() angenommen (inkl. UI-Drosselung)
+  SendToTx,       // Warten in der TX-Queue
+  TxToConfirm,    // Frame auf Serial2 -> ACK/Meldung des Radios
+  InputToTx,      // Ende zu Ende: Eingabe -> Frame geht ans Radio
+  InputToFrame,   // Ende zu Ende: Eingabe -> OLED zeigt den Wert
+  COUNT
+};
+
+typedef Log2Histogram<24> LatencyHistogram;   // µs, bis ~8 s
+
+// Eingabe-Kontext: neue Wunschfrequenzen zwischen begin und end gehören zu
+// dieser Eingabe (LatencyEvents in app_events.h öffnet dann den Trace).
+void latency_input_begin(LatencyOrigin o, uint32_t t0_us);
+void latency_input_end();
+
+void latency_record(LatencyOrigin o, LatencyStage s, uint32_t us);
+
+// Stufen einer Wunschfrequenz; unbekannte seq (ohne Eingabe-Kontext, z.B.
+// vom Radio übernommen) werden ignoriert.
+void latency_mark_sent(uint16_t seq, uint32_t t_us);
+void latency_mark_tx(uint16_t seq, uint32_t t_us);
+void latency_mark_confirmed(uint16_t seq, uint32_t t_us);
+void latency_mark_frame(uint16_t seq, uint32_t t_us);
+
+LatencyHistogram latency_histogram(LatencyOrigin o, LatencyStage s);
+void latency_reset();
+
+const char* latency_origin_name(LatencyOrigin o);
+const char* latency_stage_name(LatencyStage s);
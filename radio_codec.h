@@ -0,0 +1,690 @@
+#pragma once
+// Protokoll-Codecs für radio_link.cpp
+//
+// Jeder Codec ist eine Policy-Klasse mit statischen Encodern und einem
+// zustandsbehafteten Decoder. radio_link.cpp benutzt genau einen davon,
+// ausgewählt zur Compile-Zeit über RADIO_CODEC (config.h) – keine
+// virtuellen Aufrufe, kein String-Bau im Sende-/Empfangspfad.
+//
+//   DmCodec   Text, "\nDM:<cmd>\r", Antworten "o" / "ds" / "dg..."
+//   CatCodec  Kenwood-CAT, "FA00014074000;" – keine ACKs, kein Handshake
+//   CivCodec  Icom CI-V, binär "FE FE <radio> <ctrl> <cmd> ... FD"
+//
+// Ein Codec stellt bereit:
+//   static constexpr bool HAS_OPEN / HAS_REMOTE / HAS_ACK
+//   static bool encodeOpen / encodeRemote / encodeSetFreq / encodeSetRxFreq /
+//               encodeQuery / encodeSetMode / encodeSetPreset / encodeRaw
+//   bool feed(uint8_t byte, RadioReply& out)   -> true = Antwort komplett
+//
+// Encoder liefern false, wenn der Befehl im Protokoll nicht existiert.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "config.h"   // RadioMode
+
+// ---------- Frame ----------
+// Längster Rohbefehl (radio_raw, ohne Header/Footer); CAP reicht dafür plus
+// Rahmen des Codecs (DM "\nDM:" + "\r", CI-V Präambel/Adressen + FD).
+// Alle festen Befehle sind kürzer ("\nDM:FF SRF<hz>;TF<hz>\r": 34 Bytes).
+static constexpr uint8_t RADIO_RAW_CORE_MAX = 64;
+
+struct RadioFrame {
+  static constexpr uint8_t CAP = RADIO_RAW_CORE_MAX + 8;
+  uint8_t data[CAP];
+  uint8_t len = 0;
+
+  void clear() { len = 0; }
+
+  bool put(uint8_t b) {
+    if (len >= CAP) return false;
+    data[len++] = b;
+    return true;
+  }
+
+  bool append(const char* s) {
+    while (*s) if (!put((uint8_t)*s++)) return false;
+    return true;
+  }
+
+  // Dezimal ohne führende Nullen (width = 0) bzw. mit Nullen aufgefüllt
+  bool putDec(uint32_t v, uint8_t width = 0) {
+    char tmp[10];
+    uint8_t n = 0;
+    do {
+      tmp[n++] = (char)('0' + v % 10);
+      v /= 10;
+    } while (v && n < sizeof(tmp));
+    while (n < width && n < sizeof(tmp)) tmp[n++] = '0';
+    while (n) if (!put((uint8_t)tmp[--n])) return false;
+    return true;
+  }
+};
+
+// ---------- Antwort ----------
+enum class RadioReplyKind : uint8_t {
+  None,
+  OpenAck,       // Schnittstelle geöffnet
+  Ack,           // Befehl ausgeführt
+  AckNoChange,   // z.B. DM "ds100ENTER": war schon im Zielzustand
+  Nak,           // Befehl abgelehnt
+  Values,        // Abfrageergebnis(se) in fields
+  Unknown
+};
+
+// Abfragbare Werte (Abfrage und Antwort)
+enum class RadioField : uint8_t {
+  RxFreq,
+  TxFreq,
+  Mode,      // Wert = (int32_t)RadioMode
+  Preset,
+  SMeter,
+  TxPower,
+  Swr        // x100
+};
+
+struct RadioReply {
+  static constexpr uint8_t MAX_FIELDS = 4;
+
+  RadioReplyKind kind = RadioReplyKind::None;
+  uint8_t count = 0;
+  RadioField field[MAX_FIELDS];
+  int32_t value[MAX_FIELDS];
+
+  void reset(RadioReplyKind k) {
+    kind = k;
+    count = 0;
+  }
+
+  void add(RadioField f, int32_t v) {
+    if (count >= MAX_FIELDS) return;
+    field[count] = f;
+    value[count] = v;
+    count++;
+  }
+
+  bool get(RadioField f, int32_t& v) const {
+    for (uint8_t i = 0; i < count; i++) {
+      if (field[i] == f) {
+        v = value[i];
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+// ---------- Hilfen ----------
+namespace radio_codec_detail {
+
+// Zeilenpuffer für Textprotokolle
+template <uint8_t CAP>
+struct LineBuffer {
+  char buf[CAP + 1];
+  uint8_t len = 0;
+  bool overflow = false;
+
+  void clear() { len = 0; overflow = false; }
+
+  void push(char c) {
+    if (len < CAP) buf[len++] = c;
+    else overflow = true;
+  }
+
+  const char* terminate() {
+    buf[len] = 0;
+    return buf;
+  }
+};
+
+// Dezimalzahl ab p, bis zum ersten Nicht-Ziffer-Zeichen
+inline int32_t parseDec(const char* p, const char* end) {
+  bool neg = false;
+  if (p < end && *p == '-') { neg = true; p++; }
+  int32_t v = 0;
+  while (p < end && *p >= '0' && *p <= '9') v = v * 10 + (*p++ - '0');
+  return neg ? -v : v;
+}
+
+inline bool startsWith(const char* p, const char* end, const char* prefix) {
+  while (*prefix) {
+    if (p >= end || *p != *prefix) return false;
+    p++;
+    prefix++;
+  }
+  return true;
+}
+
+}  // namespace radio_codec_detail
+
+// =====================================================================
+// DM (Text): "\nDM:FF SRF14074000;TF14074000\r"
+// =====================================================================
+struct DmCodec {
+  static constexpr bool HAS_OPEN = true;
+  static constexpr bool HAS_REMOTE = true;
+  static constexpr bool HAS_ACK = true;
+
+  static constexpr const char* HEADER = "\nDM:";     // Prefix vor JEDEM Radiobefehl
+  static constexpr const char* FOOTER = "\r";        // Suffix
+  static constexpr char CMD_SEPARATOR = ';';         // mehrere Befehle im selben Frame
+
+  // Für OPEN gibt's KEIN "DM:" Prefix, nur <LF>O<CR>
+  static bool encodeOpen(RadioFrame& f) {
+    f.clear();
+    return f.append("\nO\r");
+  }
+
+  static bool encodeRemote(RadioFrame& f, bool on) {
+    return core(f, on ? "REMOTE SENTER2,0" : "REMOTE SENTER0");
+  }
+
+  // RX und TX gemeinsam: "FF SRF<hz>;TF<hz>"
+  static bool encodeSetFreq(RadioFrame& f, uint32_t hz) {
+    begin(f);
+    f.append("FF SRF");
+    f.putDec(hz);
+    f.put((uint8_t)CMD_SEPARATOR);
+    f.append("TF");
+    f.putDec(hz);
+    return end(f);
+  }
+
+  static bool encodeSetRxFreq(RadioFrame& f, uint32_t hz) {
+    begin(f);
+    f.append("FF SRF");
+    f.putDec(hz);
+    return end(f);
+  }
+
+  static bool encodeQuery(RadioFrame& f, RadioField what) {
+    switch (what) {
+      case RadioField::RxFreq:  return core(f, "FF GRF");
+      case RadioField::TxFreq:  return core(f, "FF GTF");
+      case RadioField::Mode:    return core(f, "FF GMD");
+      case RadioField::Preset:  return core(f, "GR GPRS");
+      case RadioField::SMeter:  return core(f, "FF GRS");   // anpassen
+      case RadioField::TxPower: return core(f, "FF GTP");   // anpassen
+      case RadioField::Swr:     return core(f, "FF GSW");   // anpassen
+    }
+    return false;
+  }
+
+  // Multi-command inquiry: "FF GRF;TF"
+  static bool encodeQueryRxTx(RadioFrame& f) {
+    return core(f, "FF GRF;TF");
+  }
+
+  static bool encodeSetMode(RadioFrame& f, RadioMode m) {
+    int code = modeCode(m);
+    if (code < 0) return false;
+    begin(f);
+    f.append("FF SMD");
+    f.putDec((uint32_t)code);
+    return end(f);
+  }
+
+  static bool encodeSetPreset(RadioFrame& f, uint8_t page) {
+    begin(f);
+    f.append("GR SPRS");
+    f.putDec(page);
+    return end(f);
+  }
+
+  // core ohne Header/Footer, z.B. "FF SRF 1500000"
+  static bool encodeRaw(RadioFrame& f, const char* core_) {
+    return core(f, core_);
+  }
+
+  static int modeCode(RadioMode m) {
+    switch (m) {
+      case RadioMode::CW:  return 8;    // A1A
+      case RadioMode::AM:  return 9;    // A3E
+      case RadioMode::USB: return 12;   // J3E+
+      case RadioMode::LSB: return 14;   // J3E-
+      case RadioMode::FM:  return 17;   // F3E
+      default:             return -1;
+    }
+  }
+
+  static RadioMode modeFromCode(int32_t code) {
+    switch (code) {
+      case 8:  return RadioMode::CW;
+      case 9:  return RadioMode::AM;
+      case 12: return RadioMode::USB;
+      case 14:
+      case 15: return RadioMode::LSB;
+      case 17: return RadioMode::FM;
+      default: return RadioMode::UNKNOWN;
+    }
+  }
+
+  // ---------- Decoder ----------
+  // Frames: optional <LF>, Inhalt, <CR>
+  bool feed(uint8_t b, RadioReply& out) {
+    char c = (char)b;
+    if (c == '\n') return false;               // Start-of-frame ignorieren
+    if (c != '\r') {
+      line_.push(c);
+      return false;
+    }
+    if (line_.overflow || line_.len == 0) {
+      line_.clear();
+      return false;
+    }
+    const char* s = line_.terminate();
+    parse(s, s + line_.len, out);
+    memcpy(last_, s, (size_t)line_.len + 1);
+    lastLen_ = line_.len;
+    line_.clear();
+    return true;
+  }
+
+  const uint8_t* lastFrame() const { return (const uint8_t*)last_; }
+  uint8_t lastFrameLen() const { return lastLen_; }
+
+private:
+  radio_codec_detail::LineBuffer<64> line_;
+  char last_[65] = {0};
+  uint8_t lastLen_ = 0;
+
+  static void begin(RadioFrame& f) {
+    f.clear();
+    f.append(HEADER);
+  }
+
+  static bool end(RadioFrame& f) {
+    return f.append(FOOTER);
+  }
+
+  static bool core(RadioFrame& f, const char* c) {
+    begin(f);
+    f.append(c);
+    return end(f);
+  }
+
+  static void parse(const char* s, const char* e, RadioReply& out) {
+    using namespace radio_codec_detail;
+    size_t n = (size_t)(e - s);
+
+    // führende Leerzeichen weg (Radio schickt teils " ds")
+    while (s < e && *s == ' ') s++;
+    while (e > s && e[-1] == ' ') e--;
+    n = (size_t)(e - s);
+
+    if (n == 1 && s[0] == 'o')                 { out.reset(RadioReplyKind::OpenAck); return; }
+    if (n == 2 && s[0] == 'd' && s[1] == 's')  { out.reset(RadioReplyKind::Ack); return; }
+    if (n == 10 && memcmp(s, "ds100ENTER", 10) == 0) { out.reset(RadioReplyKind::AckNoChange); return; }
+    if (n >= 2 && s[0] == 'd' && s[1] == 'e')  { out.reset(RadioReplyKind::Nak); return; }
+    if (n < 2 || s[0] != 'd' || s[1] != 'g')   { out.reset(RadioReplyKind::Unknown); return; }
+
+    // "dgRF72125000;TF60000000"
+    out.reset(RadioReplyKind::Values);
+    const char* p = s + 2;
+    while (p < e) {
+      const char* t = p;
+      while (p < e && *p != CMD_SEPARATOR) p++;
+      const char* te = p;
+      if (p < e) p++;
+      while (t < te && *t == ' ') t++;
+
+      if (startsWith(t, te, "RF"))       out.add(RadioField::RxFreq, parseDec(t + 2, te));
+      else if (startsWith(t, te, "TF"))  out.add(RadioField::TxFreq, parseDec(t + 2, te));
+      else if (startsWith(t, te, "MD"))  out.add(RadioField::Mode, (int32_t)modeFromCode(parseDec(t + 2, te)));
+      else if (startsWith(t, te, "PRS")) out.add(RadioField::Preset, parseDec(t + 3, te));
+      else if (startsWith(t, te, "RS"))  out.add(RadioField::SMeter, parseDec(t + 2, te));
+      else if (startsWith(t, te, "TP"))  out.add(RadioField::TxPower, parseDec(t + 2, te));
+      else if (startsWith(t, te, "SW"))  out.add(RadioField::Swr, parseDec(t + 2, te));
+    }
+  }
+};
+
+// =====================================================================
+// CAT (Kenwood-Stil): "FA00014074000;" – Setzbefehle ohne Antwort
+// =====================================================================
+struct CatCodec {
+  static constexpr bool HAS_OPEN = false;
+  static constexpr bool HAS_REMOTE = false;
+  static constexpr bool HAS_ACK = false;
+
+  // Kein Handshake: Frequenzabfrage dient als "OPEN"
+  static bool encodeOpen(RadioFrame& f) { return encodeQuery(f, RadioField::RxFreq); }
+  static bool encodeRemote(RadioFrame&, bool) { return false; }
+
+  static bool encodeSetFreq(RadioFrame& f, uint32_t hz) {
+    f.clear();
+    f.append("FA");
+    f.putDec(hz, 11);
+    f.append(";FB");
+    f.putDec(hz, 11);
+    return f.put(';');
+  }
+
+  static bool encodeSetRxFreq(RadioFrame& f, uint32_t hz) {
+    f.clear();
+    f.append("FA");
+    f.putDec(hz, 11);
+    return f.put(';');
+  }
+
+  static bool encodeQuery(RadioFrame& f, RadioField what) {
+    f.clear();
+    switch (what) {
+      case RadioField::RxFreq:  return f.append("FA;");
+      case RadioField::TxFreq:  return f.append("FB;");
+      case RadioField::Mode:    return f.append("MD;");
+      case RadioField::Preset:  return f.append("MC;");
+      case RadioField::SMeter:  return f.append("SM0;");
+      case RadioField::TxPower: return f.append("PC;");
+      case RadioField::Swr:     return f.append("RM1;");
+    }
+    return false;
+  }
+
+  static bool encodeQueryRxTx(RadioFrame& f) {
+    f.clear();
+    return f.append("FA;FB;");
+  }
+
+  static bool encodeSetMode(RadioFrame& f, RadioMode m) {
+    int code = modeCode(m);
+    if (code < 0) return false;
+    f.clear();
+    f.append("MD");
+    f.putDec((uint32_t)code);
+    return f.put(';');
+  }
+
+  static bool encodeSetPreset(RadioFrame& f, uint8_t page) {
+    f.clear();
+    f.append("MC");
+    f.putDec(page, 3);
+    return f.put(';');
+  }
+
+  static bool encodeRaw(RadioFrame& f, const char* core_) {
+    f.clear();
+    f.append(core_);
+    size_t n = strlen(core_);
+    if (n == 0 || core_[n - 1] != ';') return f.put(';');
+    return true;
+  }
+
+  static int modeCode(RadioMode m) {
+    switch (m) {
+      case RadioMode::LSB: return 1;
+      case RadioMode::USB: return 2;
+      case RadioMode::CW:  return 3;
+      case RadioMode::FM:  return 4;
+      case RadioMode::AM:  return 5;
+      default:             return -1;
+    }
+  }
+
+  static RadioMode modeFromCode(int32_t code) {
+    switch (code) {
+      case 1: return RadioMode::LSB;
+      case 2: return RadioMode::USB;
+      case 3: return RadioMode::CW;
+      case 4: return RadioMode::FM;
+      case 5: return RadioMode::AM;
+      default: return RadioMode::UNKNOWN;
+    }
+  }
+
+  // ---------- Decoder ----------
+  // Antworten enden mit ';', "?;" = Fehler
+  bool feed(uint8_t b, RadioReply& out) {
+    char c = (char)b;
+    if (c == '\r' || c == '\n') return false;
+    if (c != ';') {
+      line_.push(c);
+      return false;
+    }
+    if (line_.overflow || line_.len == 0) {
+      line_.clear();
+      return false;
+    }
+    const char* s = line_.terminate();
+    parse(s, s + line_.len, out);
+    memcpy(last_, s, (size_t)line_.len + 1);
+    lastLen_ = line_.len;
+    line_.clear();
+    return true;
+  }
+
+  const uint8_t* lastFrame() const { return (const uint8_t*)last_; }
+  uint8_t lastFrameLen() const { return lastLen_; }
+
+private:
+  radio_codec_detail::LineBuffer<40> line_;
+  char last_[41] = {0};
+  uint8_t lastLen_ = 0;
+
+  static void parse(const char* s, const char* e, RadioReply& out) {
+    using namespace radio_codec_detail;
+    if (e - s == 1 && s[0] == '?') { out.reset(RadioReplyKind::Nak); return; }
+
+    out.reset(RadioReplyKind::Values);
+    if (startsWith(s, e, "FA"))       out.add(RadioField::RxFreq, parseDec(s + 2, e));
+    else if (startsWith(s, e, "FB"))  out.add(RadioField::TxFreq, parseDec(s + 2, e));
+    else if (startsWith(s, e, "MD"))  out.add(RadioField::Mode, (int32_t)modeFromCode(parseDec(s + 2, e)));
+    else if (startsWith(s, e, "MC"))  out.add(RadioField::Preset, parseDec(s + 2, e));
+    else if (startsWith(s, e, "SM"))  out.add(RadioField::SMeter, parseDec(s + 3, e));
+    else if (startsWith(s, e, "PC"))  out.add(RadioField::TxPower, parseDec(s + 2, e));
+    else if (startsWith(s, e, "RM1")) out.add(RadioField::Swr, parseDec(s + 3, e));
+    else out.reset(RadioReplyKind::Unknown);
+  }
+};
+
+// =====================================================================
+// CI-V (Icom, binär): FE FE <radio> <ctrl> <cmd> [sub] [data] FD
+// =====================================================================
+struct CivCodec {
+  static constexpr bool HAS_OPEN = false;
+  static constexpr bool HAS_REMOTE = false;
+  static constexpr bool HAS_ACK = true;
+
+  static constexpr uint8_t PREAMBLE = 0xFE;
+  static constexpr uint8_t EOM = 0xFD;
+  static constexpr uint8_t ACK = 0xFB;
+  static constexpr uint8_t NAK = 0xFA;
+  static constexpr uint8_t RADIO_ADDR = 0x94;   // anpassen (CI-V-Adresse des Geräts)
+  static constexpr uint8_t CTRL_ADDR = 0xE0;
+
+  static bool encodeOpen(RadioFrame& f) { return encodeQuery(f, RadioField::RxFreq); }
+  static bool encodeRemote(RadioFrame&, bool) { return false; }
+
+  static bool encodeSetFreq(RadioFrame& f, uint32_t hz) {
+    begin(f, 0x05);
+    putBcdFreq(f, hz);
+    return end(f);
+  }
+
+  static bool encodeSetRxFreq(RadioFrame& f, uint32_t hz) {
+    return encodeSetFreq(f, hz);
+  }
+
+  static bool encodeQuery(RadioFrame& f, RadioField what) {
+    switch (what) {
+      case RadioField::RxFreq:  begin(f, 0x03); return end(f);
+      case RadioField::Mode:    begin(f, 0x04); return end(f);
+      case RadioField::SMeter:  begin(f, 0x15); f.put(0x02); return end(f);
+      case RadioField::TxPower: begin(f, 0x15); f.put(0x11); return end(f);
+      case RadioField::Swr:     begin(f, 0x15); f.put(0x12); return end(f);
+      default:                  return false;
+    }
+  }
+
+  static bool encodeQueryRxTx(RadioFrame& f) {
+    return encodeQuery(f, RadioField::RxFreq);
+  }
+
+  static bool encodeSetMode(RadioFrame& f, RadioMode m) {
+    int code = modeCode(m);
+    if (code < 0) return false;
+    begin(f, 0x06);
+    f.put((uint8_t)code);
+    return end(f);
+  }
+
+  // Speicherkanal wählen: 08 <kanal BCD 2 Byte>
+  static bool encodeSetPreset(RadioFrame& f, uint8_t page) {
+    begin(f, 0x08);
+    f.put(0x00);
+    f.put(toBcd(page));
+    return end(f);
+  }
+
+  // core = Hex-Bytes zwischen Adressen und FD, z.B. "03" oder "15 02"
+  static bool encodeRaw(RadioFrame& f, const char* core_) {
+    f.clear();
+    f.put(PREAMBLE);
+    f.put(PREAMBLE);
+    f.put(RADIO_ADDR);
+    f.put(CTRL_ADDR);
+    int hi = -1;
+    for (const char* p = core_; *p; p++) {
+      int v = hexVal(*p);
+      if (v < 0) continue;
+      if (hi < 0) hi = v;
+      else {
+        f.put((uint8_t)((hi << 4) | v));
+        hi = -1;
+      }
+    }
+    return end(f);
+  }
+
+  static int modeCode(RadioMode m) {
+    switch (m) {
+      case RadioMode::LSB: return 0x00;
+      case RadioMode::USB: return 0x01;
+      case RadioMode::AM:  return 0x02;
+      case RadioMode::CW:  return 0x03;
+      case RadioMode::FM:  return 0x05;
+      default:             return -1;
+    }
+  }
+
+  static RadioMode modeFromCode(int32_t code) {
+    switch (code) {
+      case 0x00: return RadioMode::LSB;
+      case 0x01: return RadioMode::USB;
+      case 0x02: return RadioMode::AM;
+      case 0x03: return RadioMode::CW;
+      case 0x05: return RadioMode::FM;
+      default:   return RadioMode::UNKNOWN;
+    }
+  }
+
+  // ---------- Decoder ----------
+  bool feed(uint8_t b, RadioReply& out) {
+    if (b == PREAMBLE) {
+      // FE mitten im Frame: Kollision -> neuer Frame; überzählige FE ignorieren
+      if (len_ >= 2 && buf_[len_ - 1] != PREAMBLE) len_ = 0;
+      if (len_ < 2) buf_[len_++] = b;
+      return false;
+    }
+    if (len_ < 2) {           // Müll zwischen Frames
+      len_ = 0;
+      return false;
+    }
+    if (b != EOM) {
+      if (len_ < sizeof(buf_)) buf_[len_++] = b;
+      else len_ = 0;
+      return false;
+    }
+
+    uint8_t n = len_;
+    len_ = 0;
+    memcpy(last_, buf_, n);
+    lastLen_ = n;
+    if (n < 5) return false;
+    // Echo eigener Frames auf dem Eindraht-Bus ignorieren
+    if (buf_[2] != CTRL_ADDR) return false;
+    parse(buf_ + 4, n - 4, out);
+    return true;
+  }
+
+  const uint8_t* lastFrame() const { return last_; }
+  uint8_t lastFrameLen() const { return lastLen_; }
+
+private:
+  uint8_t buf_[24];
+  uint8_t len_ = 0;
+  uint8_t last_[24];
+  uint8_t lastLen_ = 0;
+
+  static void begin(RadioFrame& f, uint8_t cmd) {
+    f.clear();
+    f.put(PREAMBLE);
+    f.put(PREAMBLE);
+    f.put(RADIO_ADDR);
+    f.put(CTRL_ADDR);
+    f.put(cmd);
+  }
+
+  static bool end(RadioFrame& f) {
+    return f.put(EOM);
+  }
+
+  static uint8_t toBcd(uint8_t v) {
+    return (uint8_t)(((v / 10) << 4) | (v % 10));
+  }
+
+  static int hexVal(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  }
+
+  // 5 Byte BCD, niederwertigste Stellen zuerst
+  static void putBcdFreq(RadioFrame& f, uint32_t hz) {
+    for (uint8_t i = 0; i < 5; i++) {
+      uint8_t lo = (uint8_t)(hz % 10); hz /= 10;
+      uint8_t hi = (uint8_t)(hz % 10); hz /= 10;
+      f.put((uint8_t)((hi << 4) | lo));
+    }
+  }
+
+  static int32_t bcdToInt(const uint8_t* p, uint8_t n, bool littleEndian) {
+    int32_t v = 0;
+    for (uint8_t i = 0; i < n; i++) {
+      uint8_t b = littleEndian ? p[n - 1 - i] : p[i];
+      v = v * 100 + (b >> 4) * 10 + (b & 0x0F);
+    }
+    return v;
+  }
+
+  // p zeigt auf <cmd>, n = Bytes bis vor FD
+  static void parse(const uint8_t* p, uint8_t n, RadioReply& out) {
+    uint8_t cmd = p[0];
+    if (cmd == ACK) { out.reset(RadioReplyKind::Ack); return; }
+    if (cmd == NAK) { out.reset(RadioReplyKind::Nak); return; }
+
+    out.reset(RadioReplyKind::Values);
+    if ((cmd == 0x03 || cmd == 0x00) && n >= 6) {
+      out.add(RadioField::RxFreq, bcdToInt(p + 1, 5, true));
+    } else if ((cmd == 0x04 || cmd == 0x01) && n >= 2) {
+      out.add(RadioField::Mode, (int32_t)modeFromCode(p[1]));
+    } else if (cmd == 0x15 && n >= 4) {
+      int32_t v = bcdToInt(p + 2, 2, false);   // 0000..0255
+      if (p[1] == 0x02) out.add(RadioField::SMeter, v);
+      else if (p[1] == 0x11) out.add(RadioField::TxPower, v);
+      else if (p[1] == 0x12) out.add(RadioField::Swr, v);
+      else out.reset(RadioReplyKind::Unknown);
+    } else {
+      out.reset(RadioReplyKind::Unknown);
+    }
+  }
+};
+
+// ---------- Auswahl ----------
+#ifndef RADIO_CODEC
+#define RADIO_CODEC DmCodec
+#endif
+
+using RadioCodec = RADIO_CODEC;
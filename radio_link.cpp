@@ -1,60 +1,123 @@
 #include "radio_link.h"
-#include "display.h"
+#include "app_state.h"
+#include "telemetry.h"
+#include "latency_trace.h"
+#include "radio_codec.h"
 
 static HardwareSerial& R = Serial2;
 
+// --- Protokoll (radio_codec.h, Auswahl per RADIO_CODEC) ---
+static RadioCodec codec;
+
 // --- TX Queue (ring buffer) ---
 static const int QSIZE = 20;
-static String q[QSIZE];
+static RadioFrame q[QSIZE];
+static uint32_t qFreqHz[QSIZE];        // Frequenz-Befehl: Zielwert, sonst 0
+static uint8_t qFreqCount = 0;         // davon Frequenz-Befehle
 static volatile int qHead = 0;
 static volatile int qTail = 0;
 
 static uint32_t lastTxMs = 0;
 static const uint32_t TX_GAP_MS = 25;
 
-static String rxLine;
-static String lastRx;
 static bool ready = false;
 
-static String rxBuf;
-static String lastLine;
+// --- Link-Überwachung ---
+static uint32_t lastRxMs = 0;          // letztes Lebenszeichen vom Radio
+static uint32_t openSentMs = 0;        // letztes OPEN
+static bool probePending = false;      // Keepalive gesendet, Antwort offen
+static uint32_t probeSentMs = 0;
+static bool reconnectWanted = false;   // nach Wiederkehr REMOTE erneut aktivieren
+static uint32_t lostAtMs = 0;
+static uint32_t ackWaitSinceMs = 0;    // Mode/REMOTE gesendet, WAIT_*_ACK seit
+static uint32_t txHoldUntilMs = 0;     // Mode ohne ACK: Radio schaltet noch um
+static bool replyPending = false;      // gesendet, noch keine Antwort
+
+// --- Frequenz-Abgleich (Wunsch AppState::freq_hz gegen freq_radio_hz) ---
+static uint16_t freqReqSeq = 0;        // freq_seq des zuletzt angeforderten Wunschs
+static uint32_t freqSentMs = 0;        // zuletzt Frequenz gesendet bzw. nachgefragt
+static uint32_t freqAwaitHz = 0;       // zuletzt gesendete Frequenz
+static bool freqAwaitAck = false;      // nächste Antwort gehört zu diesem Frequenz-Befehl
+static bool freqVerifyAsked = false;   // nach dem Timeout schon abgefragt
+static uint8_t freqRetries = 0;
+static bool freqGaveUp = false;
+static RadioLinkStats linkStats;
+
+// --- Telemetrie-Sampler ---
+// Kanal -> abgefragtes Feld; Befehl und Antwortformat liefert der Codec
+struct TelemetryQuery {
+  TelemetryChannel ch;
+  RadioField field;
+};
+
+static const TelemetryQuery TELEMETRY_QUERIES[TELEMETRY_CHANNEL_COUNT] = {
+  { TelemetryChannel::SMETER,   RadioField::SMeter  },
+  { TelemetryChannel::TX_POWER, RadioField::TxPower },
+  { TelemetryChannel::SWR,      RadioField::Swr     },
+};
+
+static bool telemEnabled = RADIO_TELEMETRY_ENABLED;
+static uint32_t telemPeriodMs = RADIO_TELEMETRY_PERIOD_MS;
+static uint8_t telemNext = 0;          // nächster Kanal (round robin)
+static bool telemPending = false;      // Antwort ausstehend
+static uint32_t telemSentMs = 0;
+
+// Frame lesbar ausgeben: Text bleibt Text, \n/\r und Binärbytes als Escape
+static void debugFrame(const char* tag, const uint8_t* d, uint8_t n){
+  Serial.print(tag);
+  for(uint8_t i = 0; i < n; i++){
+    uint8_t b = d[i];
+    if(b == '\n') Serial.print("\\n");
+    else if(b == '\r') Serial.print("\\r");
+    else if(b >= 0x20 && b < 0x7F) Serial.print((char)b);
+    else Serial.printf("<%02X>", b);
+  }
+  Serial.println();
+}
 
 static bool q_empty(){ return qHead == qTail; }
 static bool q_full(){ return ((qTail + 1) % QSIZE) == qHead; }
 
-static bool q_push(const String& s){
+static bool q_push(const RadioFrame& f, uint32_t freqHz){
   if(q_full()) return false;
-  q[qTail] = s;
+  q[qTail] = f;
+  qFreqHz[qTail] = freqHz;
+  if(freqHz) qFreqCount++;
   qTail = (qTail + 1) % QSIZE;
-  if (RADIO_DEBUG_MIRROR) Serial.println("[q_push][RADIO] " + s);
+  if (RADIO_DEBUG_MIRROR) debugFrame("[q_push][RADIO] ", f.data, f.len);
   return true;
 }
 
-static bool q_pop(String& out){
+static bool q_pop(RadioFrame& out, uint32_t& freqHz){
   if(q_empty()) return false;
   out = q[qHead];
+  freqHz = qFreqHz[qHead];
+  if(freqHz) qFreqCount--;
   qHead = (qHead + 1) % QSIZE;
-  if (RADIO_DEBUG_MIRROR) Serial.println("[q_pop][RADIO] " + out);
+  if (RADIO_DEBUG_MIRROR) debugFrame("[q_pop][RADIO] ", out.data, out.len);
   return true;
 }
 
-// ---------- Protocol helpers ----------
-static String radio_build(const String& cmd, const String& param = ""){
-  String s;
-  s.reserve(64);
-  s += RADIO_HEADER;    // "\nDM:"
-  s += cmd;             // "FF SRF" oder "REMOTE SENTER2,0" ...
-  if(param.length()){
-    s += RADIO_DELIMITER; // "" laut Doku
-    s += param;           // "30100000"
-  }
-  s += RADIO_FOOTER;    // "\r"
-  return s;
+static uint8_t q_clear(){
+  uint8_t n = 0;
+  while(!q_empty()){
+    q[qHead].clear();
+    qHead = (qHead + 1) % QSIZE;
+    n++;
+  }
+  qFreqCount = 0;
+  return n;
+}
+
+static uint8_t q_depth(){
+  return (uint8_t)((qTail - qHead + QSIZE) % QSIZE);
 }
 
-// Für OPEN/close gibt's KEIN "DM:" Prefix, nur <LF>O<CR>
-static String radio_open_serial(){
-  return String("\n") + "O" + "\r";
+// "busy": voll gelaufen -> bis zur Hälfte geleert (AppState::busy)
+static void q_setBusy(bool busy){
+  if(app_state().busy == busy) return;
+  app_state_set_busy(busy);
+  if (RADIO_DEBUG_MIRROR) Serial.println(busy ? "[q_setBusy][RADIO] busy" : "[q_setBusy][RADIO] not busy");
 }
 
 // ---------- State machine ----------
@@ -62,82 +125,125 @@ static String radio_open_serial(){
 // static RadioState st = RadioState::BOOT;
 
 
-static void enqueueOrDrop(const String& s){
-  if(!q_push(s)){
-    if (RADIO_DEBUG_MIRROR) Serial.println("[enqueueOrDrop][RADIO] TX queue full, drop!");
-  } else
-  {if (RADIO_DEBUG_MIRROR) Serial.println("[enqueueOrDrop][RADIO] enqueued: " + s);}
+const char* radio_admit_to_string(RadioAdmit a){
+  switch(a){
+    case RadioAdmit::QUEUED:      return "queued";
+    case RadioAdmit::SENT:        return "sent";
+    case RadioAdmit::QUEUE_FULL:  return "queue_full";
+    case RadioAdmit::NOT_READY:   return "not_ready";
+    case RadioAdmit::UNSUPPORTED: return "unsupported";
+    default:                      return "unknown";
+  }
 }
 
-static void sendNow(const String& s){
-  R.print(s);
-  lastTxMs = millis();
-  if (RADIO_DEBUG_MIRROR) Serial.println("[sendNow][RADIO TX] " + s);
+// Queue nimmt nur an, solange die Frames auch gesendet werden können:
+// verbunden bzw. Verbindung angefordert, Radio nicht verloren.
+bool radio_link_accepts(RadioState link, bool lost){
+  if(lost) return false;
+  switch(link){
+    case RadioState::READY:
+    case RadioState::WAIT_SET_MODE_ACK:
+    case RadioState::WAIT_CONNECT_ACK:
+      return true;
+    default:
+      return false;
+  }
 }
 
-static void radio_start_communication(){
-  // Boot: OPEN senden
-  if (RADIO_DEBUG_MIRROR) Serial.println("[radio_start_communication][RADIO] try to open comport");
-  sendNow(radio_open_serial());
-  global_radio_state.state = RadioState::WAIT_OPEN_ACK;
-  if (RADIO_STATE_MIRROR) Serial.println("[State]->WAIT_OPEN_ACK");
+// REMOTE an/aus nur bei offenem Port und ohne offenen Handshake. Sonst
+// würde REMOTE z.B. in WAIT_OPEN_ACK den Port als offen ausgeben (ACK-Timeout)
+// oder in WAIT_SET_MODE_ACK das ACK des Mode-Wechsels übernehmen.
+bool radio_link_accepts_remote(RadioState link, bool lost){
+  if(lost) return false;
+  return link == RadioState::COM_PORT_IS_OPEN || link == RadioState::READY;
 }
 
-// --- Remote control ---
-static String cmd_remoteOn()  {
-  if (RADIO_DEBUG_MIRROR) Serial.println("[cmd_remoteOn]");
-  return radio_build("REMOTE SENTER2,0"); 
+// Mode geht sofort raus und wartet selbst auf ein ACK: nur ohne offenen
+// Handshake, sonst hielte das ACK von REMOTE bzw. vom vorigen Mode-Wechsel
+// als Mode-ACK her (und der Connect gälte als gescheitert).
+bool radio_link_accepts_mode(RadioState link, bool lost){
+  return !lost && link == RadioState::READY;
 }
 
-static String cmd_remoteOff() { 
-  if (RADIO_DEBUG_MIRROR) Serial.println("[cmd_remoteOff]");
-  return radio_build("REMOTE SENTER0"); 
+static bool radio_link_accepting(){
+  return radio_link_accepts(app_state().link, linkStats.lost);
 }
 
-// --- Frequenz ---
-static String cmd_getRxFreq() { return radio_build("FF GRF"); }
-static String cmd_getTxFreq() { return radio_build("FF GTF"); }
+// Encoder liefert false, wenn der Befehl im Protokoll fehlt oder nicht in den Frame passt
+// freqHz: Zielwert, wenn f ein Frequenz-Befehl ist (Abgleich / ACK-Zuordnung)
+static RadioAdmit enqueueOrDrop(const RadioFrame& f, bool encoded, uint32_t freqHz = 0){
+  if(!encoded){
+    if (RADIO_DEBUG_MIRROR) Serial.println("[enqueueOrDrop][RADIO] not supported by codec, drop!");
+    return RadioAdmit::UNSUPPORTED;
+  }
+  if(!radio_link_accepting()){
+    linkStats.rejected_not_ready++;
+    if (RADIO_DEBUG_MIRROR) Serial.println("[enqueueOrDrop][RADIO] link not ready, drop!");
+    return RadioAdmit::NOT_READY;
+  }
+  if(!q_push(f, freqHz)){
+    linkStats.tx_queue_full++;
+    q_setBusy(true);
+    if (RADIO_DEBUG_MIRROR) Serial.println("[enqueueOrDrop][RADIO] TX queue full, drop!");
+    return RadioAdmit::QUEUE_FULL;
+  }
+  if (RADIO_DEBUG_MIRROR) debugFrame("[enqueueOrDrop][RADIO] enqueued: ", f.data, f.len);
+  return RadioAdmit::QUEUED;
+}
 
-static String cmd_setRxFreq(uint32_t hz) {
-  return radio_build("FF SRF", String(hz));
+uint8_t radio_queue_depth(){
+  return q_depth();
 }
-static String cmd_setTxFreq(uint32_t hz) {
-  return radio_build("FF STF", String(hz));
+
+uint8_t radio_queue_capacity(){
+  return QSIZE - 1;   // ein Slot bleibt im Ring frei
 }
 
-// --- Mode ---
-static String cmd_getMode() {
-  return radio_build("FF GMD");
+bool radio_queue_busy(){
+  return app_state().busy;
 }
 
-// --- Presets ---
-static String cmd_getPresetPage() {
-  return radio_build("GR GPRS");
+// Bis der älteste Eintrag raus ist, vergeht höchstens ein TX-Abstand;
+// für ein Drittel der Queue Luft reichen depth/3 Abstände.
+uint32_t radio_retry_after_ms(){
+  uint32_t slots = q_depth() / 3 + 1;
+  return slots * TX_GAP_MS;
 }
-static String cmd_setPresetPage(int page) {
-  return radio_build("GR SPRS", String(page));
+
+static void sendNow(const RadioFrame& f){
+  R.write(f.data, f.len);
+  lastTxMs = millis();
+  replyPending = true;
+  linkStats.tx_frames++;
+  if (RADIO_DEBUG_MIRROR) debugFrame("[sendNow][RADIO TX] ", f.data, f.len);
 }
 
-// --- Modes ---
-static String cmd_modeA1A()  { return radio_build("FF SMD8");  }  // CW
-static String cmd_modeA3E()  { return radio_build("FF SMD9");  }  // AM
-static String cmd_modeJ3EP() { return radio_build("FF SMD12"); }  // USB
-static String cmd_modeJ3EM() { return radio_build("FF SMD15"); }  // LSB
-static String cmd_modeF3E()  { return radio_build("FF SMD17"); }  // FM
+static void radio_start_communication(){
+  // Boot: OPEN senden
+  if (RADIO_DEBUG_MIRROR) Serial.println("[radio_start_communication][RADIO] try to open comport");
+  RadioFrame f;
+  RadioCodec::encodeOpen(f);
+  sendNow(f);
+  openSentMs = lastTxMs;
+  app_state_set_link(RadioState::WAIT_OPEN_ACK);
+  if (RADIO_STATE_MIRROR) Serial.println("[State]->WAIT_OPEN_ACK");
+}
 
 // --- Send helper ---
 
 bool radio_is_ready(){
-  return global_radio_state.state == RadioState::READY;
+  return app_state().link == RadioState::READY;
 }
 
+// REMOTE an/aus ohne Zustandsprüfung (bei den High-level commands)
+static RadioAdmit remoteOn();
+static RadioAdmit remoteOff();
+
 void radio_init(){
   R.begin(RADIO_BAUD, SERIAL_8N1, RADIO_RX_PIN, RADIO_TX_PIN);
-  rxBuf.reserve(128);
-  lastLine.reserve(128);
-  radio_send_disconnect();  // wenn radio schon online
+  remoteOff();  // wenn radio schon online
   
-  global_radio_state.state = RadioState::BOOT;
+  app_state_set_link(RadioState::BOOT);
   if (RADIO_STATE_MIRROR) Serial.println("[State]->BOOT");
   if (RADIO_DEBUG_MIRROR) Serial.println("[radio_init][RADIO] init");
   radio_start_communication();
@@ -147,146 +253,314 @@ void get_radio_settings(){
 
 }
 
-// ---------- RX parsing ----------
-static void run_state_machine(const String& line){
-  lastLine = line;
-  if (RADIO_DEBUG_MIRROR) Serial.println("[run_state_machine][RADIO RX] " + lastLine);
-
-  // Doku: open-ack: "o"
-  if(global_radio_state.state == RadioState::WAIT_OPEN_ACK){
-    if(line == "o"){
-      if (RADIO_DEBUG_MIRROR) Serial.println("[run_state_machine][RADIO RX] response: " + line);
-      // Remote operational preset 0 aktivieren
-      global_radio_state.state = RadioState::COM_PORT_IS_OPEN;
-      if (RADIO_STATE_MIRROR) Serial.println("[State]->COM_PORT_IS_OPEN");
-      // ----- auto-connect -----
-      // sendNow(radio_build("REMOTE SENTER2,0"));
-      // global_radio_state.state = RadioState::WAIT_CONNECT_ACK;
-      // if (RADIO_STATE_MIRROR) Serial.println("[State]->WAIT_CONNECT_ACK");
+// ---------- Link-Überwachung ----------
+static void radio_link_lost(uint32_t now){
+  linkStats.lost = true;
+  linkStats.losses++;
+  linkStats.last_detect_ms = now - lastRxMs;
+  if(linkStats.last_detect_ms > linkStats.max_detect_ms) linkStats.max_detect_ms = linkStats.last_detect_ms;
+  lostAtMs = now;
+
+  // REMOTE war aktiv (oder wurde gerade angefordert) -> nach Wiederkehr neu verbinden
+  reconnectWanted = app_state().connected
+                 || app_state().link == RadioState::WAIT_CONNECT_ACK;
+
+  // Ins Leere gequeuete Frames verwerfen, sie wären nach Wiederkehr veraltet
+  linkStats.dropped_on_loss += q_clear();
+  q_setBusy(false);
+  probePending = false;
+  telemPending = false;
+  replyPending = false;
+  freqAwaitAck = false;
+
+  app_state_set_connected(false);
+  app_state_set_desired_mode(app_state().mode);   // offener Mode-Wechsel verfällt
+
+  Serial.print("[radio_link_lost][RADIO] radio lost, no RX for ");
+  Serial.print(linkStats.last_detect_ms);
+  Serial.println(" ms");
+  radio_start_communication();
+}
+
+static void radio_link_restored(){
+  linkStats.lost = false;
+  linkStats.last_reconnect_ms = millis() - lostAtMs;
+  reconnectWanted = false;
+  Serial.print("[radio_link_restored][RADIO] radio back after ");
+  Serial.print(linkStats.last_reconnect_ms);
+  Serial.println(" ms");
+}
+
+// Kein ACK auf Mode / REMOTE: Befehl gilt als gescheitert, der Zustand
+// davor bleibt (Aufrufer sehen das über AppState/AppBus).
+static void radio_ack_timeout(){
+  linkStats.ack_timeouts++;
+  RadioState was = app_state().link;
+  Serial.print("[radio_ack_timeout][RADIO] no ACK in ");
+  Serial.println(radio_state_to_string(was));
+
+  if(was == RadioState::WAIT_SET_MODE_ACK){
+    app_state_set_desired_mode(app_state().mode);
+    app_state_set_link(RadioState::READY);
+    return;
+  }
+  if(was == RadioState::WAIT_CONNECT_ACK && linkStats.lost){
+    // Wiederverbinden nach Verlust: Handshake neu, reconnectWanted bleibt
+    radio_start_communication();
+    return;
+  }
+  app_state_set_link(app_state().connected ? RadioState::READY : RadioState::COM_PORT_IS_OPEN);
+}
+
+// Keepalive: nur wenn seit RADIO_KEEPALIVE_IDLE_MS nichts empfangen wurde.
+// Jede RX-Zeile (auch Telemetrie) gilt als Lebenszeichen.
+static void radio_supervise_link(){
+  uint32_t now = millis();
+  RadioState link = app_state().link;
+
+  if((link == RadioState::WAIT_SET_MODE_ACK || link == RadioState::WAIT_CONNECT_ACK ||
+      link == RadioState::WAIT_DISCONNECT_ACK) && now - ackWaitSinceMs >= RADIO_ACK_TIMEOUT_MS){
+    radio_ack_timeout();
+    return;
+  }
+
+  switch(link){
+    case RadioState::BOOT:
+      return;
+
+    case RadioState::WAIT_OPEN_ACK:
+      // Radio aus oder noch nicht da -> OPEN periodisch wiederholen
+      if(now - openSentMs >= RADIO_REOPEN_INTERVAL_MS) radio_start_communication();
       return;
+
+    case RadioState::READY:
+    case RadioState::COM_PORT_IS_OPEN:
+      if(now - lastRxMs < RADIO_KEEPALIVE_IDLE_MS) return;
+      if(!probePending){
+        if(now - lastTxMs < TX_GAP_MS) return;
+        // READY: leichte Abfrage (liefert nebenbei die Frequenz),
+        // sonst OPEN erneut senden (Antwort "o")
+        RadioFrame f;
+        if(app_state().link == RadioState::READY) RadioCodec::encodeQuery(f, RadioField::RxFreq);
+        else RadioCodec::encodeOpen(f);
+        sendNow(f);
+        probePending = true;
+        probeSentMs = now;
+        linkStats.keepalives++;
+        return;
+      }
+      if(now - probeSentMs >= RADIO_KEEPALIVE_TIMEOUT_MS) radio_link_lost(now);
+      return;
+
+    default:
+      // Warten auf ACK: ohne jede Antwort gilt dieselbe Schranke
+      if(now - lastRxMs >= RADIO_KEEPALIVE_IDLE_MS + RADIO_KEEPALIVE_TIMEOUT_MS
+         && now - lastTxMs >= RADIO_KEEPALIVE_TIMEOUT_MS){
+        radio_link_lost(now);
+      }
+      return;
+  }
+}
+
+RadioLinkStats radio_link_stats(){
+  return linkStats;
+}
+
+uint32_t radio_last_rx_ms(){
+  return lastRxMs;
+}
+
+// ---------- Frequenz-Abgleich ----------
+// Vom Radio bestätigt/gemeldet; ist damit der aktuelle Wunsch bestätigt,
+// endet die Latenz-Stufe TxToConfirm
+static void confirmFreq(uint32_t hz){
+  app_state_confirm_freq(hz);
+  const AppState& s = app_state();
+  if(app_state_freq_confirmed(s)) latency_mark_confirmed(s.freq_seq, micros());
+}
+
+// Meldung vom Radio (Abfrage, Keepalive). War der Wunsch bestätigt und das
+// Radio meldet etwas anderes, wurde am Radio selbst verstellt -> übernehmen.
+// Sonst bestätigt sie den Wunsch oder bleibt eine Abweichung für
+// radio_reconcile_freq().
+
+static void radio_freq_report(uint32_t hz){
+  bool wasConfirmed = app_state_freq_confirmed(app_state());
+  confirmFreq(hz);
+  if(wasConfirmed && app_state().freq_hz != hz){
+    linkStats.freq_adopted++;
+    app_state_set_freq(hz);   // == freq_radio_hz -> gleich bestätigt
+  }
+}
+
+static bool encodeFreq(RadioFrame& f, uint32_t hz){
+  if(hz < FREQ_TX_MIN_HZ) return RadioCodec::encodeSetRxFreq(f, hz);
+  return RadioCodec::encodeSetFreq(f, hz);
+}
+
+// Wunsch gesendet, aber nach RADIO_FREQ_CONFIRM_MS nicht bestätigt: erst
+// nachfragen, dann bis RADIO_FREQ_RETRIES mal neu senden, danach gilt der
+// Wert des Radios. Noch ungesendete Wünsche (UI drosselt) bleiben unberührt.
+static void radio_reconcile_freq(){
+  const AppState& s = app_state();
+  if(s.link != RadioState::READY) return;
+  if(app_state_freq_confirmed(s)){
+    freqRetries = 0;
+    freqVerifyAsked = false;
+    return;
+  }
+  if(freqGaveUp || s.freq_seq != freqReqSeq || qFreqCount) return;
+
+  uint32_t now = millis();
+  if(now - freqSentMs < RADIO_FREQ_CONFIRM_MS) return;
+
+  RadioFrame f;
+  if(!freqVerifyAsked){
+    if(radio_admit_ok(enqueueOrDrop(f, RadioCodec::encodeQuery(f, RadioField::RxFreq)))){
+      freqVerifyAsked = true;
+      freqSentMs = now;
     }
+    return;
   }
+  if(freqRetries < RADIO_FREQ_RETRIES){
+    if(radio_admit_ok(enqueueOrDrop(f, encodeFreq(f, s.freq_hz), s.freq_hz))){
+      freqRetries++;
+      linkStats.freq_resends++;
+      freqVerifyAsked = false;
+      freqSentMs = now;
+      if (RADIO_DEBUG_MIRROR) Serial.println("[radio_reconcile_freq][RADIO] not confirmed, resend");
+    }
+    return;
+  }
+  // Radio nimmt den Wunsch nicht an -> anzeigen, was es wirklich hat
+  linkStats.freq_give_ups++;
+  freqGaveUp = true;
+  Serial.println("[radio_reconcile_freq][RADIO] frequency not accepted by radio");
+  if(s.freq_radio_hz) app_state_set_freq(s.freq_radio_hz);
+}
 
-  if(global_radio_state.state == RadioState::COM_PORT_IS_OPEN){
-    
+// ---------- RX parsing ----------
+static void radio_apply_values(const RadioReply& rep){
+  uint32_t now = millis();
+  for(uint8_t i = 0; i < rep.count; i++){
+    int32_t v = rep.value[i];
+    switch(rep.field[i]){
+      case RadioField::RxFreq:
+        if(v > 0) radio_freq_report((uint32_t)v);
+        break;
+      case RadioField::Mode:
+        if (RADIO_DEBUG_MIRROR) {
+          Serial.print("[run_state_machine][mode]: ");
+          Serial.println(radio_mode_to_string((RadioMode)v));
+        }
+        break;
+      default:
+        // S-Meter / TX-Leistung / SWR
+        for(uint8_t t = 0; t < TELEMETRY_CHANNEL_COUNT; t++){
+          if(TELEMETRY_QUERIES[t].field == rep.field[i]){
+            telemetry_push(TELEMETRY_QUERIES[t].ch, v, now);
+            telemPending = false;
+          }
+        }
+        break;
+      // ggf. TF später nutzen
+    }
   }
-  if(global_radio_state.state == RadioState::READY){
-    
+}
+
+static void run_state_machine(const RadioReply& rep){
+  if (RADIO_DEBUG_MIRROR) debugFrame("[run_state_machine][RADIO RX] ", codec.lastFrame(), codec.lastFrameLen());
+
+  // Doku: open-ack: "o". Ohne OPEN im Protokoll gilt jede Antwort als Lebenszeichen.
+  if(app_state().link == RadioState::WAIT_OPEN_ACK){
+    if(rep.kind == RadioReplyKind::OpenAck || !RadioCodec::HAS_OPEN){
+      // Remote operational preset 0 aktivieren
+      app_state_set_link(RadioState::COM_PORT_IS_OPEN);
+      if (RADIO_STATE_MIRROR) Serial.println("[State]->COM_PORT_IS_OPEN");
+      if(linkStats.lost){
+        if(reconnectWanted){
+          // war vor dem Verlust remote verbunden -> Handshake fortsetzen
+          remoteOn();
+        } else {
+          radio_link_restored();
+        }
+      }
+      // ----- auto-connect -----
+      // radio_send_connect();
+      if(RadioCodec::HAS_OPEN) return;
+    }
   }
 
   // ------------- connect / disconnect ------------------------
 
-  if(global_radio_state.state == RadioState::WAIT_CONNECT_ACK){
-    if(line == "ds100ENTER"){
+  if(app_state().link == RadioState::WAIT_CONNECT_ACK){
+    if(rep.kind == RadioReplyKind::AckNoChange){
       if (RADIO_DEBUG_MIRROR) Serial.println("[run_state_machine][RADIO RX] tried to disconnect, but we're already disconnected!");
       if (RADIO_STATE_MIRROR) Serial.println("[State]->COM_PORT_IS_OPEN (ds100)");
-      global_radio_state.radio_connected = true;
+      app_state_set_connected(true);
     }
-    if(line == "ds"){ // line == "ds"
-      global_radio_state.state = RadioState::READY;
+    if(rep.kind == RadioReplyKind::Ack){
+      // Ergebnis vor dem Zustandswechsel: wer auf das Verlassen von
+      // WAIT_*_ACK reagiert, sieht schon den neuen Wert
+      app_state_set_connected(true);
+      app_state_set_link(RadioState::READY);
       if (RADIO_STATE_MIRROR) Serial.println("[State]->READY (ds)");
-      global_radio_state.radio_connected = true;
-      displaySetConnected(global_radio_state.radio_connected);
-
-
-      // return;
+      if(linkStats.lost) radio_link_restored();
     }
   }
 
-  if(global_radio_state.state == RadioState::WAIT_DISCONNECT_ACK){
-    if(line == "ds100ENTER"){
+  if(app_state().link == RadioState::WAIT_DISCONNECT_ACK){
+    if(rep.kind == RadioReplyKind::AckNoChange){
       if (RADIO_DEBUG_MIRROR) Serial.println("[run_state_machine][RADIO RX] tried to disconnect, but we're already disconnected!");
       if (RADIO_STATE_MIRROR) Serial.println("[State]->COM_PORT_IS_OPEN");
     }
-    if(line == "ds"){
-      global_radio_state.state = RadioState::COM_PORT_IS_OPEN;
+    if(rep.kind == RadioReplyKind::Ack){
+      app_state_set_connected(false);
+      app_state_set_link(RadioState::COM_PORT_IS_OPEN);
       if (RADIO_STATE_MIRROR) Serial.println("[State]->COM_PORT_IS_OPEN");
-      global_radio_state.radio_connected = false;
-      displaySetConnected(global_radio_state.radio_connected);
     }
   }
 
   //--------------------------- set / change modulation mode ------------------------
 
-  if(global_radio_state.state == RadioState::WAIT_SET_MODE_ACK){
-    if(line == "ds"){
-      global_radio_state.state = RadioState::READY;
+  if(app_state().link == RadioState::WAIT_SET_MODE_ACK){
+    if(rep.kind == RadioReplyKind::Ack){
+      app_state_set_mode(app_state().desired_mode);
+      app_state_set_link(RadioState::READY);
       if (RADIO_STATE_MIRROR) {
         Serial.print("[run_state_machine][WAIT_SET_MODE_ACK][State]->");
-        Serial.println(radio_state_to_string(global_radio_state.state));
+        Serial.println(radio_state_to_string(app_state().link));
         Serial.print("[run_state_machine][RADIO RX] Radio Mode was set to:");
-        Serial.println(global_radio_state.mode_str);
+        Serial.println(radio_mode_to_string(app_state().desired_mode));
       }
       if (RADIO_STATE_MIRROR) Serial.println("[State]->READY");
       if (RADIO_DEBUG_MIRROR) {
         Serial.print("[run_state_machine][radio_mode]->actual: ");
-        Serial.println(radio_mode_to_string(global_radio_state.mode));
+        Serial.println(radio_mode_to_string(app_state().mode));
         Serial.print("[run_state_machine][radio_mode]->desired: ");
-        Serial.println(radio_mode_to_string(global_radio_state.desired_mode));
+        Serial.println(radio_mode_to_string(app_state().desired_mode));
       }
-      global_radio_state.mode = global_radio_state.desired_mode;
-      displaySetMode(global_radio_state.mode);
-      global_radio_state.mode_str = radio_mode_to_string(global_radio_state.mode);
-
     }
   }
-  if(line.startsWith("dgMD")){
-    String payload = line.substring(4);
-    if (RADIO_DEBUG_MIRROR) {
-      Serial.print("[run_state_machine][dgMD]: ");
-      Serial.println(payload);
-    }
-    
-  }
+
   // Doku: get-response: "dg...."
   // Beispiel: dgRF72125000;TF60000000
-  if(line.startsWith("dg")){
-    String payload = line.substring(2); // nach "dg"
-    // Tokens split by ';'
-    int start = 0;
-    while(true){
-      int sep = payload.indexOf(RADIO_CMD_SEPARATOR, start);
-      String tok = (sep < 0) ? payload.substring(start) : payload.substring(start, sep);
-      tok.trim();
-      if(tok.length()){
-        // RF<Hz> / TF<Hz>
-        if(tok.startsWith("RF")){
-          uint32_t hz = (uint32_t)tok.substring(2).toInt();
-          if(hz > 0) global_radio_state.freq_hz = hz; // du nutzt aktuell UI für RX freq
-        }
-        // ggf. TF später nutzen
-      }
-      if(sep < 0) break;
-      start = sep + 1;
-    }
-  }
+  if(rep.kind == RadioReplyKind::Values) radio_apply_values(rep);
 }
 
 static void radio_read_rx(){
+  RadioReply rep;
   while(R.available() > 0){
-    char c = (char)R.read();
-
-    if(c == '\n'){
-      // Start-of-frame LF -> ignorieren wir, wir sammeln nur bis CR
-      // Serial.println("[radio]->[cr]");
-      continue;
-    }
-    if(c == '\r'){
-      // End-of-frame
-      String line = rxBuf;
-      line.trim();
-      if (line.charAt(0) == '\n') {
-        line.remove(0, 1);
-      }
-
-      if (RADIO_DEBUG_MIRROR) Serial.print("[radio]->[lf] " + line);
-      rxBuf = "";
-      // line.trim();
-      if(line.length()) run_state_machine(line);
-      continue;
-    }
-
-    if(rxBuf.length() < 200) rxBuf += c;
+    if(!codec.feed((uint8_t)R.read(), rep)) continue;
+    lastRxMs = millis();
+    linkStats.rx_lines++;
+    probePending = false;
+    bool freqReply = freqAwaitAck;
+    freqAwaitAck = false;
+    replyPending = false;
+    run_state_machine(rep);
+    // ACK auf den Frequenz-Befehl: Radio hat genau diesen Wert übernommen
+    if(freqReply && rep.kind == RadioReplyKind::Ack) confirmFreq(freqAwaitHz);
   }
 }
 
@@ -296,55 +570,160 @@ uint32_t radio_last_tx_ms() {
 }
 
 String radio_last_rx_line() {
-  return lastRx;
-}
-
-static uint32_t parseLastNumber(const String& s) {
-  // nimmt die letzte zusammenhängende Zifferngruppe im String
-  int i = s.length() - 1;
-  while (i >= 0 && (s[i] < '0' || s[i] > '9')) i--;
-  if (i < 0) return 0;
-  int end = i;
-  while (i >= 0 && (s[i] >= '0' && s[i] <= '9')) i--;
-  int start = i + 1;
-  return (uint32_t)s.substring(start, end + 1).toInt();
+  String s;
+  const uint8_t* d = codec.lastFrame();
+  uint8_t n = codec.lastFrameLen();
+  s.reserve(n);
+  for(uint8_t i = 0; i < n; i++){
+    if(d[i] >= 0x20 && d[i] < 0x7F) {
+      s += (char)d[i];
+    } else {
+      char hex[5];
+      snprintf(hex, sizeof(hex), "<%02X>", d[i]);
+      s += hex;
+    }
+  }
+  return s;
 }
 
 // ---------- TX flush ----------
 static void radio_flush_tx(){
-  if(global_radio_state.state != RadioState::READY){
+  if(app_state().link != RadioState::READY){
     return; // erst nach Handshake senden!
   }
   if(q_empty()) return;
 
   uint32_t now = millis();
   if(now - lastTxMs < TX_GAP_MS) return;
+  if((int32_t)(now - txHoldUntilMs) < 0) return;
 
-  String out;
-  if(q_pop(out)){
-    if (RADIO_DEBUG_MIRROR) Serial.println("[radio_flush_tx][RADIO] Try to send: " + out);
+  RadioFrame out;
+  uint32_t freqHz = 0;
+  if(q_pop(out, freqHz)){
+    // ACK eindeutig zuordenbar nur, wenn vorher nichts mehr offen war
+    bool quiet = !replyPending || now - lastTxMs >= RADIO_ACK_TIMEOUT_MS;
     sendNow(out);
+    if(freqHz){
+      freqSentMs = lastTxMs;
+      freqAwaitHz = freqHz;
+      // überholte Werte (Wunsch inzwischen weiter) zählen nicht
+      if(freqHz == app_state().freq_hz) latency_mark_tx(app_state().freq_seq, micros());
+    }
+    freqAwaitAck = freqHz && quiet && RadioCodec::HAS_ACK;
+  }
+  if(app_state().busy && q_depth() <= QSIZE / 2) q_setBusy(false);
+}
+
+// ---------- Telemetrie ----------
+// Fragt reihum einen Kanal ab, aber nur wenn der Link sonst nichts zu tun hat:
+// Queue leer, TX-Abstand eingehalten und keine Telemetrie-Antwort offen.
+static void radio_sample_telemetry(){
+  if(!telemEnabled) return;
+  if(app_state().link != RadioState::READY) return;
+
+  uint32_t now = millis();
+  if(telemPending){
+    if(now - telemSentMs < RADIO_TELEMETRY_REPLY_TIMEOUT_MS) return;
+    telemPending = false; // keine Antwort -> weiter mit nächstem Kanal
   }
+  if(!q_empty()) return;
+  if(now - lastTxMs < TX_GAP_MS) return;
+  if(now - telemSentMs < telemPeriodMs / TELEMETRY_CHANNEL_COUNT) return;
+
+  const TelemetryQuery& tq = TELEMETRY_QUERIES[telemNext];
+  telemNext = (telemNext + 1) % TELEMETRY_CHANNEL_COUNT;
+
+  RadioFrame f;
+  telemSentMs = now;
+  if(!RadioCodec::encodeQuery(f, tq.field)) return;   // Kanal gibt's im Protokoll nicht
+  sendNow(f);
+  telemPending = true;
+}
+
+void radio_telemetry_enable(bool on){
+  telemEnabled = on;
+  telemPending = false;
+}
+
+bool radio_telemetry_enabled(){
+  return telemEnabled;
+}
+
+void radio_telemetry_set_period(uint32_t ms){
+  if(ms < TX_GAP_MS * TELEMETRY_CHANNEL_COUNT) ms = TX_GAP_MS * TELEMETRY_CHANNEL_COUNT;
+  telemPeriodMs = ms;
+}
+
+uint32_t radio_telemetry_period_ms(){
+  return telemPeriodMs;
 }
 
 void radio_loop(){
   radio_read_rx();
   radio_flush_tx();
+  radio_reconcile_freq();
+  radio_supervise_link();
+  radio_sample_telemetry();
 }
 
 // ---------- High-level commands ----------
-void radio_send_connect(){
-  // enqueueOrDrop(radio_build("REMOTE SENTER2,0"));
-  sendNow(radio_build("REMOTE SENTER2,0"));
-  global_radio_state.state = RadioState::WAIT_CONNECT_ACK;
+// REMOTE an/aus ohne Prüfung des Link-Zustands: radio_init() (Boot) und das
+// Wiederverbinden nach einem Verlust in run_state_machine(). Von außen nur
+// über radio_send_connect()/radio_send_disconnect().
+// Protokolle ohne REMOTE-Umschaltung (CAT, CI-V) sind nach dem OPEN sofort bereit
+static RadioAdmit remoteOn(){
+  if(!RadioCodec::HAS_REMOTE){
+    app_state_set_link(RadioState::READY);
+    app_state_set_connected(true);
+    if(linkStats.lost) radio_link_restored();
+    if (RADIO_STATE_MIRROR) Serial.println("[State]->READY (no remote)");
+    return RadioAdmit::SENT;
+  }
+  if (RADIO_DEBUG_MIRROR) Serial.println("[cmd_remoteOn]");
+  RadioFrame f;
+  RadioCodec::encodeRemote(f, true);
+  sendNow(f);
+  ackWaitSinceMs = lastTxMs;
+  app_state_set_link(RadioState::WAIT_CONNECT_ACK);
   if (RADIO_STATE_MIRROR) Serial.println("[State]->WAIT_CONNECT_ACK");
+  return RadioAdmit::SENT;
 }
 
-void radio_send_disconnect(){
-  // enqueueOrDrop(radio_build("REMOTE SENTER0"));
-  sendNow(radio_build("REMOTE SENTER0"));
-  global_radio_state.state = RadioState::WAIT_DISCONNECT_ACK;
+static RadioAdmit remoteOff(){
+  if(!RadioCodec::HAS_REMOTE){
+    if(app_state().link == RadioState::READY) app_state_set_link(RadioState::COM_PORT_IS_OPEN);
+    app_state_set_connected(false);
+    return RadioAdmit::SENT;
+  }
+  if (RADIO_DEBUG_MIRROR) Serial.println("[cmd_remoteOff]");
+  RadioFrame f;
+  RadioCodec::encodeRemote(f, false);
+  sendNow(f);
+  ackWaitSinceMs = lastTxMs;
+  app_state_set_link(RadioState::WAIT_DISCONNECT_ACK);
   if (RADIO_STATE_MIRROR) Serial.println("[State]->WAIT_DISCONNECT_ACK");
+  return RadioAdmit::SENT;
+}
+
+// UI/Web/Konsole (radio_link_accepts_remote)
+static bool remoteSwitchAllowed(){
+  return radio_link_accepts_remote(app_state().link, linkStats.lost);
+}
+
+RadioAdmit radio_send_connect(){
+  if(!remoteSwitchAllowed()){
+    linkStats.rejected_not_ready++;
+    return RadioAdmit::NOT_READY;
+  }
+  return remoteOn();
+}
+
+RadioAdmit radio_send_disconnect(){
+  if(!remoteSwitchAllowed()){
+    linkStats.rejected_not_ready++;
+    return RadioAdmit::NOT_READY;
+  }
+  return remoteOff();
 }
 
 static int presetToPage(const String& preset){
@@ -355,78 +734,107 @@ static int presetToPage(const String& preset){
   return p;
 }
 
-void radio_send_preset(const String& preset){
+RadioAdmit radio_send_preset(const String& preset){
   // laut deiner Liste: "GR SPRS" + page
-  enqueueOrDrop(radio_build("GR SPRS", String(presetToPage(preset))));
-}
-
-void radio_send_mode(const String& mode){
-  // Mapping gemäß deiner Liste
-  if(mode == "CW") {
-    sendNow(radio_build("FF SMD8" ));
-    global_radio_state.desired_mode = RadioMode::CW;
-  }       
-  else if(mode == "AM")  {
-    sendNow(radio_build("FF SMD9" ));
-    global_radio_state.desired_mode = RadioMode::AM;
-  }    
-  else if(mode == "FM")  {
-    sendNow(radio_build("FF SMD17"));
-    global_radio_state.desired_mode = RadioMode::FM;
-  }
-  else if(mode == "USB") {
-    sendNow(radio_build("FF SMD12"));
-    global_radio_state.desired_mode = RadioMode::USB;
-  }
-  else if(mode == "LSB") {
-    sendNow(radio_build("FF SMD14"));
-    global_radio_state.desired_mode = RadioMode::LSB;
-  }
-  else {
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeSetPreset(f, (uint8_t)presetToPage(preset)));
+}
+
+RadioMode radio_mode_from_name(const String& mode){
+  if(mode == "CW")  return RadioMode::CW;
+  if(mode == "AM")  return RadioMode::AM;
+  if(mode == "FM")  return RadioMode::FM;
+  if(mode == "USB") return RadioMode::USB;
+  if(mode == "LSB") return RadioMode::LSB;
+  return RadioMode::UNKNOWN;
+}
+
+RadioAdmit radio_send_mode(const String& mode){
+  RadioMode m = radio_mode_from_name(mode);
+  RadioFrame f;
+  if(m == RadioMode::UNKNOWN || !RadioCodec::encodeSetMode(f, m)) {
     Serial.print("[radio_send_mode]unknown radio_mode: ");
     Serial.println(mode);
+    return RadioAdmit::UNSUPPORTED;
+  }
+  // Mode geht direkt raus, aber nicht an der Queue vorbei ins Leere
+  if(!radio_link_accepts_mode(app_state().link, linkStats.lost)){
+    linkStats.rejected_not_ready++;
+    return RadioAdmit::NOT_READY;
   }
-  delay(500);
-  global_radio_state.state = RadioState::WAIT_SET_MODE_ACK;
+  // Kein delay() mehr: das ACK kommt über run_state_machine(), ohne ACK
+  // setzt radio_supervise_link() nach RADIO_ACK_TIMEOUT_MS zurück.
+  sendNow(f);
+  app_state_set_desired_mode(m);
+  if(!RadioCodec::HAS_ACK){
+    // kein ACK im Protokoll -> Befehl gilt als ausgeführt; Queue wartet,
+    // bis das Radio umgeschaltet hat
+    txHoldUntilMs = lastTxMs + RADIO_MODE_SETTLE_MS;
+    app_state_set_mode(m);
+    return RadioAdmit::SENT;
+  }
+  ackWaitSinceMs = lastTxMs;
+  app_state_set_link(RadioState::WAIT_SET_MODE_ACK);
   if (RADIO_STATE_MIRROR) {
     Serial.print("[radio_send_mode][State]->");
-    Serial.println(radio_state_to_string(global_radio_state.state));
+    Serial.println(radio_state_to_string(app_state().link));
   }
-}
-
-void radio_send_freq(uint32_t hz){
-  if(hz < FREQ_TX_MIN_HZ){
-    Serial.println("Freq < 1.500 MHz");
-    radio_send_rx_freq(global_radio_state.freq_hz);
-  } else {
-    enqueueOrDrop(radio_build("FF SRF" + String(hz) + RADIO_CMD_SEPARATOR + "TF" + String(hz) ));
+  return RadioAdmit::SENT;
+}
+
+// Setzt den Wunsch (AppState::freq_hz, unbestätigt bis das Radio ihn meldet).
+// Bei voller Queue bleibt AppState::freq_hz unverändert, damit der Aufrufer erneut senden kann.
+// Offline (NOT_READY) wird weiter lokal abgestimmt; radio_reconcile_freq()
+// gleicht nach dem Wiederverbinden ab.
+RadioAdmit radio_send_freq(uint32_t hz){
+  if(hz < FREQ_TX_MIN_HZ) Serial.println("Freq < 1.500 MHz");
+  RadioFrame f;
+  RadioAdmit a = enqueueOrDrop(f, encodeFreq(f, hz), hz);
+  if(a != RadioAdmit::QUEUE_FULL){
+    app_state_set_freq(hz);
+    freqReqSeq = app_state().freq_seq;
+    freqSentMs = millis();
+    freqRetries = 0;
+    freqVerifyAsked = false;
+    freqGaveUp = false;
+    if(radio_admit_ok(a)) latency_mark_sent(freqReqSeq, micros());
   }
-  global_radio_state.freq_hz = hz;
+  return a;
 }
 
-void radio_send_rx_freq(uint32_t hz){
-  enqueueOrDrop(radio_build("FF SRF" + String(hz) ));
+RadioAdmit radio_send_rx_freq(uint32_t hz){
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeSetRxFreq(f, hz));
 }
 
-void radio_send_raw(const String& core){
+RadioAdmit radio_send_raw(const String& core){
   if (RADIO_DEBUG_MIRROR) Serial.println("[radio_send_raw][RADIO] " + core);
-  enqueueOrDrop(radio_build(core));
+  if(core.length() > RADIO_RAW_CORE_MAX){
+    Serial.print("[radio_send_raw] too long, max ");
+    Serial.println(RADIO_RAW_CORE_MAX);
+    return RadioAdmit::UNSUPPORTED;
+  }
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeRaw(f, core.c_str()));
 }
 
-void radio_query_rx_tx_freq(){
-  // Multi-command inquiry: "FF GRF;TF"
-  // -> hier bauen wir den kompletten cmd-String inkl ';'
-  enqueueOrDrop(radio_build(String("FF GRF") + RADIO_CMD_SEPARATOR + "TF"));
+RadioAdmit radio_query_rx_tx_freq(){
+  // Multi-command inquiry, bei DM: "FF GRF;TF"
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeQueryRxTx(f));
 }
 
-void radio_query_rxfreq(){
-  enqueueOrDrop(cmd_getRxFreq());
+RadioAdmit radio_query_rxfreq(){
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeQuery(f, RadioField::RxFreq));
 }
 
-void radio_query_mode(){
-  enqueueOrDrop(cmd_getMode());
+RadioAdmit radio_query_mode(){
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeQuery(f, RadioField::Mode));
 }
 
-void radio_query_presetpage(){
-  enqueueOrDrop(cmd_getPresetPage());
+RadioAdmit radio_query_presetpage(){
+  RadioFrame f;
+  return enqueueOrDrop(f, RadioCodec::encodeQuery(f, RadioField::Preset));
 }
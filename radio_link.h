@@ -7,26 +7,84 @@
 
 const __FlashStringHelper* getRadioStateString();
 
+// Link-Überwachung (Keepalive / Verlust / Wiederverbinden)
+struct RadioLinkStats {
+  bool lost = false;              // Radio gilt als verloren, Handshake läuft
+  uint32_t losses = 0;
+  uint32_t keepalives = 0;
+  uint32_t last_detect_ms = 0;    // letztes RX bis Verlust erkannt
+  uint32_t max_detect_ms = 0;
+  uint32_t last_reconnect_ms = 0; // Verlust erkannt bis Handshake fertig
+  uint32_t dropped_on_loss = 0;   // verworfene Queue-Einträge
+  uint32_t tx_frames = 0;         // gesendete Frames
+  uint32_t rx_lines = 0;          // empfangene Zeilen
+  uint32_t tx_queue_full = 0;     // wegen voller Queue verworfen
+  uint32_t rejected_not_ready = 0; // abgelehnt, Link nicht bereit
+  uint32_t ack_timeouts = 0;      // Mode/REMOTE ohne ACK nach RADIO_ACK_TIMEOUT_MS
+  uint32_t freq_resends = 0;      // Wunschfrequenz erneut gesendet (Abgleich)
+  uint32_t freq_give_ups = 0;     // Radio nahm den Wunsch nicht an, Radiowert übernommen
+  uint32_t freq_adopted = 0;      // am Radio selbst verstellt, übernommen
+};
+
+// Ergebnis eines Sendeaufrufs – jeder Aufrufer soll es weitergeben
+// (HTTP-Status, Konsole, Display), statt Erfolg anzunehmen.
+enum class RadioAdmit : uint8_t {
+  QUEUED,       // in der TX-Queue, wird nach TX_GAP gesendet
+  SENT,         // sofort gesendet (Handshake, Mode)
+  QUEUE_FULL,   // verworfen – später erneut versuchen
+  NOT_READY,    // kein Handshake / Radio verloren
+  UNSUPPORTED   // Befehl im Protokoll nicht vorhanden oder ungültig
+};
+
+inline bool radio_admit_ok(RadioAdmit a) {
+  return a == RadioAdmit::QUEUED || a == RadioAdmit::SENT;
+}
+
+const char* radio_admit_to_string(RadioAdmit a);
+
 void radio_init();
 void radio_loop();                 // regelmäßig aufrufen
 
 bool radio_is_ready();             // z.B. Serial2 ok / optional Handshake
 
+// Nimmt der Link in diesem Zustand Befehle an? Reine Funktionen, damit auch
+// Leser mit einem AppState-Snapshot (Web-Handler) vorab prüfen können.
+bool radio_link_accepts(RadioState link, bool lost);          // Frequenz, Preset
+bool radio_link_accepts_remote(RadioState link, bool lost);   // connect / disconnect
+bool radio_link_accepts_mode(RadioState link, bool lost);     // Mode: nur READY, kein offenes ACK
+RadioMode radio_mode_from_name(const String& mode);           // UNKNOWN = kein gültiger Mode
+
 // High-level API (von GUI genutzt)
-void radio_send_connect();
-void radio_send_disconnect();
-void radio_send_preset(const String& preset);
-void radio_send_mode(const String& mode);
-void radio_send_freq(uint32_t hz);
-void radio_send_rx_freq(uint32_t hz);
+RadioAdmit radio_send_connect();
+RadioAdmit radio_send_disconnect();
+RadioAdmit radio_send_preset(const String& preset);
+RadioAdmit radio_send_mode(const String& mode);
+RadioAdmit radio_send_freq(uint32_t hz);
+RadioAdmit radio_send_rx_freq(uint32_t hz);
+
+// TX-Queue: Füllstand und geschätzte Wartezeit bis wieder Platz ist
+uint8_t radio_queue_depth();
+uint8_t radio_queue_capacity();
+bool radio_queue_busy();           // voll gelaufen, noch nicht unter die Hälfte geleert
+uint32_t radio_retry_after_ms();
 
 // Optional: Zugriff aufs letzte RX / Status
 String radio_last_rx_line();
 uint32_t radio_last_tx_ms();
+uint32_t radio_last_rx_ms();
+RadioLinkStats radio_link_stats();
 
-void radio_send_raw(const String& core); // core ohne EOL
-void radio_query_rxfreq();
+// core ohne EOL, höchstens RADIO_RAW_CORE_MAX (radio_codec.h) Zeichen;
+// länger -> UNSUPPORTED
+RadioAdmit radio_send_raw(const String& core);
+RadioAdmit radio_query_rxfreq();
 // Queries (optional)
-void radio_query_rx_tx_freq();
-void radio_query_mode();
-void radio_query_presetpage();
\ No newline at end of file
+RadioAdmit radio_query_rx_tx_freq();
+RadioAdmit radio_query_mode();
+RadioAdmit radio_query_presetpage();
+
+// Telemetrie-Sampler (S-Meter, TX-Leistung, SWR -> telemetry.h)
+void radio_telemetry_enable(bool on);
+bool radio_telemetry_enabled();
+void radio_telemetry_set_period(uint32_t ms);   // pro Kanal
+uint32_t radio_telemetry_period_ms();
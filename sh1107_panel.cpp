@@ -0,0 +1,144 @@
+#include "sh1107_panel.h"
+
+// SH1107-Commands (Datenblatt Kap. 9)
+static constexpr uint8_t CMD_DISPLAYOFF = 0xAE;
+static constexpr uint8_t CMD_DISPLAYON = 0xAF;
+static constexpr uint8_t CMD_SETPAGEADDR = 0xB0;
+static constexpr uint8_t CMD_SETCOLHIGH = 0x10;
+static constexpr uint8_t CMD_SETCOLLOW = 0x00;
+
+// Control-Bytes: Co=1 -> nach dem nächsten Byte folgt wieder ein Control-Byte
+static constexpr uint8_t CTRL_CMD_STREAM = 0x00;
+static constexpr uint8_t CTRL_CMD_SINGLE = 0x80;
+static constexpr uint8_t CTRL_DATA_STREAM = 0x40;
+
+// Wire-Puffer: eine ganze Page plus Adressierung in einer Transaktion
+static constexpr uint16_t WIRE_BUFFER = SH1107Panel::PANEL_W + SH1107Panel::WINDOW_OVERHEAD + 1;
+
+// Adafruit_I2CDevice auf dem ESP32: I2C_BUFFER_LENGTH (128) minus Prefix-Byte
+static constexpr uint8_t ADAFRUIT_CHUNK = 127;
+
+// Init für 128x128 wie Adafruit_SH1107::begin(), aber als eine Transaktion
+static const uint8_t INIT_SEQ[] = {
+  CMD_DISPLAYOFF,
+  0xD5, 0x51,   // Taktteiler
+  0x20,         // Page-Adressierung
+  0x81, 0x4F,   // Kontrast
+  0xAD, 0x8A,   // DC-DC
+  0xA0,         // Segment-Remap normal
+  0xC0,         // COM-Scan aufwärts
+  0xDC, 0x00,   // Startzeile
+  0xD3, 0x00,   // Offset (128 Zeilen: 0)
+  0xD9, 0x22,   // Precharge
+  0xDB, 0x35,   // VCOM
+  0xA8, 0x7F,   // Multiplex 128
+  0xA4,         // Anzeige aus RAM
+  0xA6,         // nicht invertiert
+};
+
+SH1107Panel::SH1107Panel(TwoWire* wire) : Adafruit_GFX(PANEL_W, PANEL_H), wire(wire) {
+  memset(buffer, 0, FRAME_BYTES);
+}
+
+void SH1107Panel::prepareBus() {
+  size_t n = wire->setBufferSize(WIRE_BUFFER);
+  wireBuf = n ? (uint16_t)n : 128;
+}
+
+void SH1107Panel::setClock(uint32_t hz) {
+  wire->setClock(hz);
+  clockHz = hz;
+}
+
+bool SH1107Panel::commandList(const uint8_t* c, uint8_t n) {
+  wire->beginTransmission(addr);
+  wire->write(CTRL_CMD_STREAM);
+  wire->write(c, n);
+  lastError = wire->endTransmission();
+  txns++;
+  return lastError == 0;
+}
+
+bool SH1107Panel::command(uint8_t c) {
+  return commandList(&c, 1);
+}
+
+bool SH1107Panel::begin(uint8_t address, uint32_t hz) {
+  addr = address;
+  const uint32_t candidates[] = { hz, 400000, 100000 };
+  bool ok = false;
+  for (uint32_t c : candidates) {
+    if (c > hz) continue;
+    setClock(c);
+    if (commandList(INIT_SEQ, sizeof(INIT_SEQ))) {
+      ok = true;
+      break;
+    }
+  }
+  if (!ok) return false;
+
+  clearDisplay();
+  delay(100);
+  return command(CMD_DISPLAYON);
+}
+
+void SH1107Panel::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+  int16_t t;
+  switch (getRotation()) {
+    case 1: t = x; x = (int16_t)(WIDTH - y - 1); y = t; break;
+    case 2: x = (int16_t)(WIDTH - x - 1); y = (int16_t)(HEIGHT - y - 1); break;
+    case 3: t = x; x = y; y = (int16_t)(HEIGHT - t - 1); break;
+  }
+  uint8_t& b = buffer[x + (y / 8) * WIDTH];
+  uint8_t bit = (uint8_t)(1 << (y & 7));
+  switch (color) {
+    case SH110X_WHITE:   b |= bit; break;
+    case SH110X_BLACK:   b &= (uint8_t)~bit; break;
+    case SH110X_INVERSE: b ^= bit; break;
+  }
+}
+
+uint16_t SH1107Panel::writeWindow(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len) {
+  const uint8_t maxData = (uint8_t)(wireBuf - WINDOW_OVERHEAD);
+  uint16_t bytes = 0;
+  while (len) {
+    uint8_t n = len < maxData ? len : maxData;
+    wire->beginTransmission(addr);
+    wire->write(CTRL_CMD_SINGLE);
+    wire->write((uint8_t)(CMD_SETPAGEADDR + page));
+    wire->write(CTRL_CMD_SINGLE);
+    wire->write((uint8_t)(CMD_SETCOLHIGH + (col >> 4)));
+    wire->write(CTRL_CMD_SINGLE);
+    wire->write((uint8_t)(CMD_SETCOLLOW + (col & 0x0F)));
+    wire->write(CTRL_DATA_STREAM);
+    wire->write(data, n);
+    lastError = wire->endTransmission();
+    txns++;
+    bytes += WINDOW_OVERHEAD + n;
+    data += n;
+    col += n;
+    len -= n;
+  }
+  return bytes;
+}
+
+uint16_t SH1107Panel::writeWindowAdafruit(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len) {
+  const uint8_t cmd[] = { (uint8_t)(CMD_SETPAGEADDR + page),
+                          (uint8_t)(CMD_SETCOLHIGH + (col >> 4)),
+                          (uint8_t)(CMD_SETCOLLOW + (col & 0x0F)) };
+  commandList(cmd, sizeof(cmd));
+  uint16_t bytes = sizeof(cmd) + 1;
+  while (len) {
+    uint8_t n = len < ADAFRUIT_CHUNK ? len : ADAFRUIT_CHUNK;
+    wire->beginTransmission(addr);
+    wire->write(CTRL_DATA_STREAM);
+    wire->write(data, n);
+    lastError = wire->endTransmission();
+    txns++;
+    bytes += n + 1;
+    data += n;
+    len -= n;
+  }
+  return bytes;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+
+// Schlanker SH1107-Treiber für das 128x128-Panel: Adafruit_GFX zum Zeichnen,
+// Framebuffer im Objekt, I2C direkt über Wire.
+//
+// Gegenüber Adafruit_SH110X:
+//   - ein Spaltenbereich einer Page = eine I2C-Transaktion: Page/Spalte als
+//     Commands mit Co-Bit (0x80), danach 0x40 und alle Datenbytes
+//     (Adafruit: eigene Command-Transaktion + Daten in 127-Byte-Häppchen)
+//   - Wire-Puffer wird auf eine ganze Page vergrößert
+//   - I2C-Takt fest auf OLED_I2C_HZ statt 400 kHz während / 100 kHz danach
+#ifndef SH110X_BLACK
+#define SH110X_BLACK 0
+#define SH110X_WHITE 1
+#define SH110X_INVERSE 2
+#endif
+
+class SH1107Panel : public Adafruit_GFX {
+public:
+  static constexpr int16_t PANEL_W = 128;
+  static constexpr int16_t PANEL_H = 128;
+  static constexpr uint8_t PAGES = PANEL_H / 8;
+  static constexpr uint16_t FRAME_BYTES = PANEL_W * PAGES;
+
+  // Bytes pro Spaltenbereich zusätzlich zu den Daten:
+  // 3 x (0x80, Command) für Page + Spalte, 1 x 0x40 vor den Daten
+  static constexpr uint8_t WINDOW_OVERHEAD = 7;
+
+  explicit SH1107Panel(TwoWire* wire = &Wire);
+
+  // Vor wire->begin() aufrufen (ESP32: Puffergröße nur vor begin() änderbar).
+  void prepareBus();
+
+  // Init-Sequenz senden. Versucht clockHz, bei fehlendem ACK 400/100 kHz.
+  bool begin(uint8_t addr, uint32_t clockHz);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void clearDisplay() { memset(buffer, 0, FRAME_BYTES); }
+  uint8_t* getBuffer() { return buffer; }
+
+  // Spalten [col, col+len) einer Page schreiben; Rückgabe: Bytes auf dem Bus
+  // (ohne Adressbyte). Teilt nur, wenn der Wire-Puffer kleiner ist als geplant.
+  uint16_t writeWindow(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len);
+
+  // Übertragungsmuster von Adafruit_SH110X::display() (nur für Vergleichsmessungen)
+  uint16_t writeWindowAdafruit(uint8_t page, uint8_t col, const uint8_t* data, uint8_t len);
+
+  bool command(uint8_t c);
+  void setClock(uint32_t hz);
+  uint32_t clock() const { return clockHz; }
+  uint32_t transactions() const { return txns; }
+  bool busError() const { return lastError != 0; }
+
+protected:
+  uint8_t buffer[FRAME_BYTES];
+
+private:
+  TwoWire* wire;
+  uint8_t addr = 0x3C;
+  uint32_t clockHz = 400000;
+  uint16_t wireBuf = 128;   // tatsächliche Wire-Puffergröße
+  uint32_t txns = 0;
+  uint8_t lastError = 0;
+
+  bool commandList(const uint8_t* c, uint8_t n);
+};
@@ -0,0 +1,203 @@
+#include "sh1107_partial.h"
+
+// front gegen shadow vergleichen und Änderungen senden; danach ist front
+// der neue shadow (Zeigertausch statt Kopie)
+void SH1107Partial::flushFront() {
+  uint32_t t0 = micros();
+  const uint8_t pages = (uint8_t)((HEIGHT + 7) / 8);
+  const uint8_t cols = (uint8_t)WIDTH;
+  const bool full = frontFull || !shadowValid;
+
+  uint16_t bytes = 0;
+  uint8_t dirtyPages = 0, runs = 0;
+
+  for (uint8_t p = 0; p < pages; p++) {
+    const uint8_t* cur = front + (uint16_t)p * cols;
+    const uint8_t* old = shadow + (uint16_t)p * cols;
+
+    if (full) {
+      bytes += writeWindow(p, 0, cur, cols);
+      runs++;
+      dirtyPages++;
+      continue;
+    }
+    if (memcmp(cur, old, cols) == 0) continue;
+    dirtyPages++;
+
+    // Geänderte Spaltenbereiche suchen, kurze Lücken zusammenfassen
+    uint8_t x = 0;
+    while (x < cols) {
+      while (x < cols && cur[x] == old[x]) x++;
+      if (x >= cols) break;
+      uint8_t start = x, end = x;   // end = letzte geänderte Spalte
+      uint8_t gap = 0;
+      for (x++; x < cols; x++) {
+        if (cur[x] != old[x]) {
+          end = x;
+          gap = 0;
+        } else if (++gap > RUN_MERGE_GAP) {
+          break;
+        }
+      }
+      bytes += writeWindow(p, start, cur + start, (uint8_t)(end - start + 1));
+      runs++;
+      x = (uint8_t)(end + 1);
+    }
+  }
+
+  uint8_t* t = shadow;
+  shadow = front;
+  front = t;
+  shadowValid = true;
+
+  uint32_t t1 = micros();
+  uint32_t us = t1 - t0;
+  portENTER_CRITICAL(&mux);
+  lastTag = frontTag;
+  lastTagUs = t1;
+  stats.frames++;
+  if (full) stats.full_frames++;
+  if (!dirtyPages) stats.skipped_frames++;
+  stats.last_pages = dirtyPages;
+  stats.last_runs = runs;
+  stats.last_bytes = bytes;
+  stats.total_bytes += bytes;
+  stats.last_us = us;
+  if (us > stats.max_us) stats.max_us = us;
+  stats.flush_us.add(us);
+  stats.frame_bytes.add(bytes);
+  portEXIT_CRITICAL(&mux);
+}
+
+void SH1107Partial::invalidate() {
+  portENTER_CRITICAL(&mux);
+  fullRequested = true;
+  portEXIT_CRITICAL(&mux);
+}
+
+void SH1107Partial::display(uint16_t tag) {
+  if (!task) {
+    memcpy(front, buffer, FRAME_BYTES);
+    frontTag = tag;
+    portENTER_CRITICAL(&mux);
+    frontFull = fullRequested;   // Voll-Anforderung zusammen mit dem Frame abholen
+    fullRequested = false;
+    portEXIT_CRITICAL(&mux);
+    flushFront();
+  } else {
+    // Neuesten Frame bereitstellen; ein noch nicht abgeholter wird überschrieben
+    portENTER_CRITICAL(&mux);
+    if (readyPending) stats.dropped_frames++;
+    memcpy(ready, buffer, FRAME_BYTES);
+    readyTag = tag;
+    readyPending = true;
+    stats.posted++;
+    portEXIT_CRITICAL(&mux);
+    xTaskNotifyGive(task);
+  }
+}
+
+uint16_t SH1107Partial::shownTag(uint32_t& atUs) {
+  portENTER_CRITICAL(&mux);
+  uint16_t tag = lastTag;
+  atUs = lastTagUs;
+  portEXIT_CRITICAL(&mux);
+  return tag;
+}
+
+void SH1107Partial::taskMain(void* arg) {
+  SH1107Partial* self = static_cast<SH1107Partial*>(arg);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    for (;;) {
+      portENTER_CRITICAL(&self->mux);
+      bool have = self->readyPending;
+      if (have) {
+        uint8_t* t = self->ready;
+        self->ready = self->front;
+        self->front = t;
+        self->frontTag = self->readyTag;
+        self->frontFull = self->fullRequested;
+        self->fullRequested = false;
+        self->readyPending = false;
+      }
+      portEXIT_CRITICAL(&self->mux);
+      if (!have) break;
+      self->flushFront();
+    }
+    if (self->benchRequested) {
+      self->runBench();
+      self->benchRequested = false;
+    }
+  }
+}
+
+bool SH1107Partial::startAsync(BaseType_t core, UBaseType_t prio, uint32_t stackBytes) {
+  if (task) return true;
+  return xTaskCreatePinnedToCore(taskMain, "oled_flush", stackBytes, this, prio, &task, core) == pdPASS;
+}
+
+void SH1107Partial::resetStats() {
+  portENTER_CRITICAL(&mux);
+  stats = DisplayFlushStats();
+  portEXIT_CRITICAL(&mux);
+}
+
+DisplayFlushStats SH1107Partial::flushStats() {
+  portENTER_CRITICAL(&mux);
+  DisplayFlushStats s = stats;
+  portEXIT_CRITICAL(&mux);
+  s.async = task != nullptr;
+  s.i2c_hz = clock();
+  s.transactions = transactions();
+  return s;
+}
+
+uint32_t SH1107Partial::timeFullFrame(bool adafruit, uint16_t& bytes, uint16_t& txCount) {
+  const uint32_t t0 = transactions();
+  const uint32_t us0 = micros();
+  bytes = 0;
+  for (uint8_t p = 0; p < PAGES; p++) {
+    const uint8_t* d = shadow + (uint16_t)p * PANEL_W;
+    bytes += adafruit ? writeWindowAdafruit(p, 0, d, PANEL_W) : writeWindow(p, 0, d, PANEL_W);
+  }
+  uint32_t us = micros() - us0;
+  txCount = (uint16_t)(transactions() - t0);
+  return us;
+}
+
+// Läuft dort, wo sonst geflusht wird (Task bzw. loop()), damit niemand
+// gleichzeitig auf den Bus schreibt. shadow = was das Panel gerade zeigt.
+void SH1107Partial::runBench() {
+  DisplayBusBench r;
+  if (shadowValid) {
+    const uint32_t hz = clock();
+    uint16_t bytes, txCount;
+    r.clock_hz = hz;
+    r.lean_us = timeFullFrame(false, r.lean_bytes, r.lean_txns);
+    setClock(400000);
+    r.lean_400k_us = timeFullFrame(false, bytes, txCount);
+    r.adafruit_us = timeFullFrame(true, r.adafruit_bytes, r.adafruit_txns);
+    setClock(hz);
+    r.ok = !busError();
+  }
+  portENTER_CRITICAL(&mux);
+  benchResult = r;
+  portEXIT_CRITICAL(&mux);
+}
+
+DisplayBusBench SH1107Partial::bench() {
+  if (!task) {
+    runBench();
+    return benchResult;
+  }
+  benchRequested = true;
+  xTaskNotifyGive(task);
+  uint32_t t0 = millis();
+  while (benchRequested && millis() - t0 < 2000) delay(5);
+  if (benchRequested) return DisplayBusBench();
+  portENTER_CRITICAL(&mux);
+  DisplayBusBench r = benchResult;
+  portEXIT_CRITICAL(&mux);
+  return r;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <Arduino.h>
+#include "sh1107_panel.h"
+#include "display.h"   // DisplayFlushStats
+
+// SH1107 mit Schattenpuffer: display() überträgt nur geänderte Pages und
+// darin nur die geänderten Spaltenbereiche, jeden als eine I2C-Transaktion
+// (SH1107Panel::writeWindow).
+//
+// Nach startAsync() gehört der I2C-Bus einer eigenen Task: display() kopiert
+// den gerenderten Puffer nur noch in einen "ready"-Slot und kehrt sofort
+// zurück. Die Task holt sich jeweils den neuesten Frame; ein Frame, der vor
+// seiner Übertragung von einem neueren überholt wird, entfällt.
+class SH1107Partial : public SH1107Panel {
+public:
+  using SH1107Panel::SH1107Panel;
+
+  // Synchron: Änderungen übertragen. Asynchron: Frame zur Übertragung einreihen.
+  // tag ist eine freie Marke des Frames (Latenzmessung: freq_seq), die
+  // shownTag() meldet, sobald der Frame übertragen ist.
+  void display(uint16_t tag = 0);
+
+  // Marke des zuletzt übertragenen Frames, atUs = Ende der Übertragung (micros)
+  uint16_t shownTag(uint32_t& atUs);
+
+  // Flush-Task starten (nach begin() und dem ersten display())
+  bool startAsync(BaseType_t core, UBaseType_t prio, uint32_t stackBytes);
+  bool isAsync() const { return task != nullptr; }
+
+  // Nächster Flush überträgt alles (z.B. nach begin() oder Display-Reset).
+  // Aus loop(), auch während die Task gerade überträgt: gilt dann für den
+  // nächsten abgeholten Frame.
+  void invalidate();
+
+  DisplayFlushStats flushStats();
+  void resetStats();
+
+  // Aktuellen Frame mehrfach komplett übertragen und messen (Bild bleibt
+  // gleich). Asynchron führt die Flush-Task die Messung aus.
+  DisplayBusBench bench();
+
+private:
+  // Lücken bis zu dieser Länge mitsenden statt neu zu adressieren
+  // (neue Transaktion = WINDOW_OVERHEAD + Adressbyte + Start/Stop)
+  static constexpr uint8_t RUN_MERGE_GAP = WINDOW_OVERHEAD + 1;
+
+  // Drei Puffer, getauscht werden nur Zeiger:
+  //   ready  - zuletzt gerenderter Frame (loop() schreibt, unter mux)
+  //   front  - wird gerade übertragen (nur Task)
+  //   shadow - zuletzt übertragener Frame (nur Task)
+  uint8_t frames[3][FRAME_BYTES];
+  uint8_t* ready = frames[0];
+  uint8_t* front = frames[1];
+  uint8_t* shadow = frames[2];
+  bool readyPending = false;
+  uint16_t readyTag = 0, frontTag = 0;   // Marken zu ready/front
+  uint16_t lastTag = 0;                  // zuletzt übertragen (unter mux)
+  uint32_t lastTagUs = 0;
+  bool fullRequested = true;   // invalidate() -> nächster Frame komplett (unter mux)
+  bool frontFull = false;      // front komplett übertragen (nur Task bzw. display() synchron)
+  bool shadowValid = false;    // shadow entspricht dem Panel (nur Task)
+
+  TaskHandle_t task = nullptr;
+  portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+  DisplayFlushStats stats;
+
+  volatile bool benchRequested = false;
+  DisplayBusBench benchResult;
+
+  void flushFront();
+  void runBench();
+  uint32_t timeFullFrame(bool adafruit, uint16_t& bytes, uint16_t& txns);
+  static void taskMain(void* arg);
+};
@@ -0,0 +1,170 @@
+#include "telemetry.h"
+
+// ---------- Delta-kodierter Ringpuffer ----------
+// Jedes Sample wird relativ zum Vorgänger abgelegt:
+//   |delta| <= 127  -> 1 Byte (int8)
+//   sonst           -> ESC (0x80) + int16 little endian (Absolutwert)
+// Der Absolutwert des ältesten Samples steht in first_value, damit beim
+// Verdrängen nicht der ganze Ring neu dekodiert werden muss.
+
+static constexpr uint8_t ESC = 0x80;
+
+struct TelemetryRing {
+  uint8_t  buf[TELEMETRY_RING_BYTES];
+  uint16_t head = 0;        // ältester Eintrag
+  uint16_t used = 0;        // belegte Bytes
+  uint32_t first_seq = 0;   // Sequenznummer des ältesten Samples
+  uint32_t next_seq = 0;    // Sequenznummer des nächsten Samples
+  int16_t  first_value = 0;
+  int16_t  last_value = 0;
+  uint32_t last_ms = 0;
+};
+
+static TelemetryRing rings[TELEMETRY_CHANNEL_COUNT];
+
+// Geschrieben wird in loop() (radio_link), gelesen auch aus dem Web-Handler
+// (AsyncTCP-Task): dropOldest() verschiebt head/first_value unter einem
+// laufenden telemetry_read() weg. Die Abschnitte sind kurz (höchstens ein
+// Ring mit TELEMETRY_RING_BYTES dekodieren).
+static portMUX_TYPE ringMux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* CHANNEL_NAMES[TELEMETRY_CHANNEL_COUNT] = { "smeter", "txpower", "swr" };
+
+const char* telemetry_channel_name(TelemetryChannel ch) {
+  uint8_t i = (uint8_t)ch;
+  return (i < TELEMETRY_CHANNEL_COUNT) ? CHANNEL_NAMES[i] : "?";
+}
+
+bool telemetry_channel_from_name(const String& name, TelemetryChannel& out) {
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+    if (name.equalsIgnoreCase(CHANNEL_NAMES[i])) {
+      out = (TelemetryChannel)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+static inline uint8_t ringAt(const TelemetryRing& r, uint16_t off) {
+  return r.buf[(r.head + off) % TELEMETRY_RING_BYTES];
+}
+
+static inline uint8_t entryLen(uint8_t first) {
+  return (first == ESC) ? 3 : 1;
+}
+
+// Dekodiert den Eintrag an Offset off relativ zu prev
+static int16_t decodeAt(const TelemetryRing& r, uint16_t off, int16_t prev) {
+  uint8_t b = ringAt(r, off);
+  if (b != ESC) return (int16_t)(prev + (int8_t)b);
+  uint16_t lo = ringAt(r, off + 1);
+  uint16_t hi = ringAt(r, off + 2);
+  return (int16_t)(lo | (hi << 8));
+}
+
+static void dropOldest(TelemetryRing& r) {
+  uint8_t len = entryLen(ringAt(r, 0));
+  r.head = (r.head + len) % TELEMETRY_RING_BYTES;
+  r.used -= len;
+  r.first_seq++;
+  if (r.used) r.first_value = decodeAt(r, 0, r.first_value);
+}
+
+static void putByte(TelemetryRing& r, uint8_t b) {
+  r.buf[(r.head + r.used) % TELEMETRY_RING_BYTES] = b;
+  r.used++;
+}
+
+void telemetry_reset() {
+  portENTER_CRITICAL(&ringMux);
+  for (uint8_t i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) rings[i] = TelemetryRing();
+  portEXIT_CRITICAL(&ringMux);
+}
+
+void telemetry_push(TelemetryChannel ch, int32_t value, uint32_t now_ms) {
+  if ((uint8_t)ch >= TELEMETRY_CHANNEL_COUNT) return;
+  TelemetryRing& r = rings[(uint8_t)ch];
+
+  if (value > INT16_MAX) value = INT16_MAX;
+  if (value < INT16_MIN) value = INT16_MIN;
+  int16_t v = (int16_t)value;
+
+  bool empty = (r.first_seq == r.next_seq);
+  int32_t delta = empty ? 0 : (int32_t)v - (int32_t)r.last_value;
+  bool small = (delta >= -127 && delta <= 127);
+  uint8_t len = small ? 1 : 3;
+
+  portENTER_CRITICAL(&ringMux);
+  while (r.used + len > TELEMETRY_RING_BYTES) dropOldest(r);
+
+  if (small) {
+    putByte(r, (uint8_t)(int8_t)delta);
+  } else {
+    putByte(r, ESC);
+    putByte(r, (uint8_t)(v & 0xFF));
+    putByte(r, (uint8_t)((uint16_t)v >> 8));
+  }
+
+  if (r.first_seq == r.next_seq) r.first_value = v;
+  r.next_seq++;
+  r.last_value = v;
+  r.last_ms = now_ms;
+  portEXIT_CRITICAL(&ringMux);
+}
+
+bool telemetry_latest(TelemetryChannel ch, int16_t& value, uint32_t& at_ms) {
+  if ((uint8_t)ch >= TELEMETRY_CHANNEL_COUNT) return false;
+  const TelemetryRing& r = rings[(uint8_t)ch];
+  portENTER_CRITICAL(&ringMux);
+  bool has = (r.first_seq != r.next_seq);
+  if (has) {
+    value = r.last_value;
+    at_ms = r.last_ms;
+  }
+  portEXIT_CRITICAL(&ringMux);
+  return has;
+}
+
+uint32_t telemetry_first_seq(TelemetryChannel ch) {
+  if ((uint8_t)ch >= TELEMETRY_CHANNEL_COUNT) return 0;
+  portENTER_CRITICAL(&ringMux);
+  uint32_t seq = rings[(uint8_t)ch].first_seq;
+  portEXIT_CRITICAL(&ringMux);
+  return seq;
+}
+
+uint32_t telemetry_next_seq(TelemetryChannel ch) {
+  if ((uint8_t)ch >= TELEMETRY_CHANNEL_COUNT) return 0;
+  portENTER_CRITICAL(&ringMux);
+  uint32_t seq = rings[(uint8_t)ch].next_seq;
+  portEXIT_CRITICAL(&ringMux);
+  return seq;
+}
+
+uint16_t telemetry_read(TelemetryChannel ch, uint32_t& cursor, int16_t* out, uint16_t maxCount) {
+  if ((uint8_t)ch >= TELEMETRY_CHANNEL_COUNT) return 0;
+  const TelemetryRing& r = rings[(uint8_t)ch];
+  portENTER_CRITICAL(&ringMux);
+
+  // Sequenznummern laufen monoton; Differenzen statt Vergleiche (Überlauf)
+  if ((int32_t)(cursor - r.first_seq) < 0) cursor = r.first_seq;
+  if ((int32_t)(cursor - r.next_seq) >= 0) {
+    cursor = r.next_seq;
+    portEXIT_CRITICAL(&ringMux);
+    return 0;
+  }
+
+  uint16_t off = 0;
+  uint32_t seq = r.first_seq;
+  int16_t v = r.first_value;
+  uint16_t n = 0;
+
+  while (off < r.used && n < maxCount) {
+    if (seq != r.first_seq) v = decodeAt(r, off, v);
+    if ((int32_t)(seq - cursor) >= 0) out[n++] = v;
+    off += entryLen(ringAt(r, off));
+    seq++;
+  }
+  portEXIT_CRITICAL(&ringMux);
+  return n;
+}
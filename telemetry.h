@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino.h>
+
+// Telemetrie-Kanäle (Index = Ringpuffer)
+enum class TelemetryChannel : uint8_t {
+  SMETER,     // Empfangspegel (S-Meter)
+  TX_POWER,   // Sendeleistung
+  SWR,        // Stehwellenverhältnis (x100)
+  COUNT
+};
+
+static constexpr uint8_t TELEMETRY_CHANNEL_COUNT = (uint8_t)TelemetryChannel::COUNT;
+
+// Bytes pro Kanal. Ein Sample kostet 1 Byte (Delta) bzw. 3 Byte (Absolutwert).
+static constexpr uint16_t TELEMETRY_RING_BYTES = 256;
+
+const char* telemetry_channel_name(TelemetryChannel ch);
+bool telemetry_channel_from_name(const String& name, TelemetryChannel& out);
+
+void telemetry_reset();
+void telemetry_push(TelemetryChannel ch, int32_t value, uint32_t now_ms);
+
+// Letzter Wert; false wenn noch kein Sample vorliegt
+bool telemetry_latest(TelemetryChannel ch, int16_t& value, uint32_t& at_ms);
+
+// Sequenznummern: [first_seq, next_seq) liegen noch im Ringpuffer
+uint32_t telemetry_first_seq(TelemetryChannel ch);
+uint32_t telemetry_next_seq(TelemetryChannel ch);
+
+// Liest ab *cursor bis zu maxCount Samples nach out.
+// Ist cursor bereits aus dem Ring gefallen, wird auf first_seq vorgezogen
+// (cursor zeigt danach auf das erste gelieferte Sample).
+uint16_t telemetry_read(TelemetryChannel ch, uint32_t& cursor, int16_t* out, uint16_t maxCount);
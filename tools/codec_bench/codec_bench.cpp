@@ -0,0 +1,168 @@
+// Host-Mikrobenchmark für die Protokoll-Codecs (radio_codec.h).
+//
+// Misst pro Codec Encode (Frequenz setzen, Abfrage, Mode) und Decode
+// (typische Antworten Byte für Byte durch feed()) in ns pro Frame und
+// prüft vorher, dass Encode/Decode die erwarteten Werte liefern.
+//
+// Build:
+//   g++ -std=gnu++17 -O2 -Itools/host -I. -o tools/bin/codec_bench
+//       tools/codec_bench/codec_bench.cpp
+// Start:
+//   tools/bin/codec_bench [--iterations N]
+
+#include "Arduino.h"
+#include "radio_codec.h"
+
+#include <chrono>
+#include <vector>
+
+static volatile uint32_t sink;   // verhindert, dass der Compiler Schleifen wegoptimiert
+
+struct Sample {
+  const char* name;
+  std::vector<uint8_t> bytes;
+};
+
+static double nsPerOp(uint64_t ns, uint64_t ops) {
+  return ops ? (double)ns / (double)ops : 0.0;
+}
+
+template <typename Fn>
+static uint64_t timeNs(Fn fn) {
+  auto t0 = std::chrono::steady_clock::now();
+  fn();
+  auto t1 = std::chrono::steady_clock::now();
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+}
+
+static std::vector<uint8_t> bytesOf(const char* s) {
+  return std::vector<uint8_t>(s, s + strlen(s));
+}
+
+// ---------- typische Antworten je Protokoll ----------
+template <typename C> std::vector<Sample> replies();
+
+template <> std::vector<Sample> replies<DmCodec>() {
+  return {
+    { "ack",    bytesOf("\nds\r") },
+    { "freq",   bytesOf("\ndgRF14074000;TF14074000\r") },
+    { "smeter", bytesOf("\ndgRS-87\r") },
+  };
+}
+
+template <> std::vector<Sample> replies<CatCodec>() {
+  return {
+    { "freq",   bytesOf("FA00014074000;") },
+    { "mode",   bytesOf("MD2;") },
+    { "smeter", bytesOf("SM00012;") },
+  };
+}
+
+template <> std::vector<Sample> replies<CivCodec>() {
+  return {
+    { "ack",    { 0xFE, 0xFE, 0xE0, 0x94, 0xFB, 0xFD } },
+    { "freq",   { 0xFE, 0xFE, 0xE0, 0x94, 0x03, 0x00, 0x40, 0x07, 0x14, 0x00, 0xFD } },
+    { "smeter", { 0xFE, 0xFE, 0xE0, 0x94, 0x15, 0x02, 0x01, 0x20, 0xFD } },
+  };
+}
+
+// ---------- Plausibilität ----------
+template <typename C>
+static bool selfTest(const char* name) {
+  bool ok = true;
+  C dec;
+  RadioReply rep;
+  int32_t v = 0;
+
+  for (const Sample& s : replies<C>()) {
+    bool done = false;
+    for (uint8_t b : s.bytes) done = dec.feed(b, rep) || done;
+    if (!done || rep.kind == RadioReplyKind::Unknown || rep.kind == RadioReplyKind::None) {
+      printf("  %s: reply '%s' not decoded\n", name, s.name);
+      ok = false;
+    }
+  }
+
+  // Frequenzantwort muss 14.074 MHz ergeben
+  for (const Sample& s : replies<C>()) {
+    if (strcmp(s.name, "freq") != 0) continue;
+    for (uint8_t b : s.bytes) dec.feed(b, rep);
+    if (!rep.get(RadioField::RxFreq, v) || v != 14074000) {
+      printf("  %s: freq decoded as %d\n", name, (int)v);
+      ok = false;
+    }
+  }
+
+  RadioFrame f;
+  if (!C::encodeSetFreq(f, 14074000UL) || f.len == 0) {
+    printf("  %s: encodeSetFreq failed\n", name);
+    ok = false;
+  }
+  return ok;
+}
+
+// ---------- Messung ----------
+template <typename C>
+static void bench(const char* name, uint32_t iterations) {
+  if (!selfTest<C>(name)) {
+    printf("%-8s self test FAILED\n", name);
+    return;
+  }
+
+  RadioFrame f;
+  uint64_t ns;
+
+  ns = timeNs([&] {
+    for (uint32_t i = 0; i < iterations; i++) {
+      C::encodeSetFreq(f, 7000000UL + i);
+      sink = f.len;
+    }
+  });
+  printf("%-8s encode set_freq  %7.1f ns/op  (%u bytes)\n", name, nsPerOp(ns, iterations), f.len);
+
+  ns = timeNs([&] {
+    for (uint32_t i = 0; i < iterations; i++) {
+      C::encodeQuery(f, (i & 1) ? RadioField::RxFreq : RadioField::SMeter);
+      sink = f.len;
+    }
+  });
+  printf("%-8s encode query     %7.1f ns/op  (%u bytes)\n", name, nsPerOp(ns, iterations), f.len);
+
+  ns = timeNs([&] {
+    for (uint32_t i = 0; i < iterations; i++) {
+      C::encodeSetMode(f, (i & 1) ? RadioMode::USB : RadioMode::LSB);
+      sink = f.len;
+    }
+  });
+  printf("%-8s encode set_mode  %7.1f ns/op  (%u bytes)\n", name, nsPerOp(ns, iterations), f.len);
+
+  for (const Sample& s : replies<C>()) {
+    C dec;
+    RadioReply rep;
+    uint32_t frames = 0;
+    ns = timeNs([&] {
+      for (uint32_t i = 0; i < iterations; i++) {
+        for (uint8_t b : s.bytes) frames += dec.feed(b, rep);
+      }
+    });
+    sink = frames + rep.count;
+    printf("%-8s decode %-9s %7.1f ns/frame (%zu bytes, %.2f ns/byte)\n", name, s.name,
+           nsPerOp(ns, frames), s.bytes.size(), nsPerOp(ns, (uint64_t)iterations * s.bytes.size()));
+  }
+}
+
+int main(int argc, char** argv) {
+  uint32_t iterations = 1000000;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) iterations = (uint32_t)atol(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  bench<DmCodec>("dm", iterations);
+  bench<CatCodec>("cat", iterations);
+  bench<CivCodec>("civ", iterations);
+  return 0;
+}
@@ -0,0 +1,372 @@
+// Host-Renderer für die OLED-Oberfläche (display_sh1107.cpp) ohne Hardware.
+//
+// Spielt Skripte (Encoder drehen, Menü, Mode-Wechsel, …) über die normalen
+// Setter (app_state_set_*, display*) ab, rendert jeden Schritt in den
+// 1-Bit-Framebuffer und misst Renderzeit sowie die Bytes, die der
+// Partial-Flush übertragen würde. Der letzte Frame jedes Skripts wird als PBM geschrieben
+// bzw. mit einem Golden Image verglichen.
+//
+// Build:
+//   g++ -std=gnu++17 -O2 -Itools/host -I. -o tools/bin/display_render
+//       tools/display_render/display_render.cpp tools/host/arduino_host.cpp
+//       tools/host/gfx_host.cpp display_sh1107.cpp sh1107_partial.cpp
+//       sh1107_panel.cpp digit_font.cpp app_state.cpp config.cpp
+// Start:
+//   tools/bin/display_render --golden tools/display_render/golden            (prüfen)
+//   tools/bin/display_render --golden tools/display_render/golden --update   (neu schreiben)
+//   tools/bin/display_render --out /tmp/frames --repeat 20                   (alle Frames, messen)
+//   tools/bin/display_render --pacing                                        (Frame-Pacing in Echtzeit)
+//   tools/bin/display_render --bus                                           (I2C-Vollbild, berechnet)
+
+#include "Arduino.h"
+#include "display.h"
+#include "config_display.h"
+#include "app_state.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct Options {
+  const char* golden = nullptr;   // Verzeichnis mit <skript>.pbm
+  bool update = false;            // Golden Images neu schreiben
+  const char* out = nullptr;      // jeden Frame als <skript>_NNN.pbm
+  int repeat = 1;                 // Durchläufe für die Zeitmessung
+  bool pacing = false;            // Echtzeit-Simulation von displayTick() beim Drehen
+  bool bus = false;               // Vollbild-Übertragung: Bytes/Transaktionen -> Buszeit
+};
+
+struct Script {
+  const char* name;
+  std::function<void()> setup;        // vollständiger Ausgangszustand
+  int steps;
+  std::function<void(int)> step;
+};
+
+struct FrameSample {
+  double render_us;
+  uint16_t bytes;
+  uint8_t pages;
+  uint8_t layers;
+};
+
+static Options opt;
+
+// ---------- Bild ----------
+// SH1107-Page-Layout -> sichtbares Bild (OLED_ROTATION 3), leuchtend = weiß
+static bool litAt(const uint8_t* fb, int x, int y) {
+  int px = y, py = OLED_H - 1 - x;
+  return fb[px + (py / 8) * OLED_W] & (1 << (py & 7));
+}
+
+static std::vector<uint8_t> toPbm(const uint8_t* fb) {
+  std::string hdr = "P4\n" + std::to_string(OLED_W) + " " + std::to_string(OLED_H) + "\n";
+  std::vector<uint8_t> img(hdr.begin(), hdr.end());
+  for (int y = 0; y < OLED_H; y++) {
+    for (int x = 0; x < OLED_W; x += 8) {
+      uint8_t b = 0;
+      for (int i = 0; i < 8; i++) {
+        if (!litAt(fb, x + i, y)) b |= (uint8_t)(0x80 >> i);   // PBM: 1 = schwarz
+      }
+      img.push_back(b);
+    }
+  }
+  return img;
+}
+
+static bool writeFile(const std::string& path, const std::vector<uint8_t>& data) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) {
+    perror(path.c_str());
+    return false;
+  }
+  bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  fclose(f);
+  return ok;
+}
+
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n;
+  data.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+static int diffPixels(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+  if (a.size() != b.size()) return -1;
+  int n = 0;
+  for (size_t i = 0; i < a.size(); i++) n += __builtin_popcount((unsigned)(a[i] ^ b[i]));
+  return n;
+}
+
+// ---------- Skripte ----------
+static void baseState(uint32_t hz) {
+  app_state_set_link(RadioState::READY);
+  app_state_set_connected(true);
+  app_state_set_busy(false);
+  app_state_set_mode(RadioMode::USB);
+  app_state_set_desired_mode(RadioMode::USB);
+  app_state_set_freq(hz);
+  app_state_confirm_freq(hz);
+  displaySetTuneMarker(false);
+  displaySetTuneSelect(false);
+  displaySetTuneCursor(2);
+  displaySetMenuIndex(0);
+}
+
+static std::vector<Script> scripts() {
+  static const RadioMode MODES[] = { RadioMode::CW, RadioMode::USB, RadioMode::LSB, RadioMode::AM };
+  return {
+    { "boot",
+      [] { baseState(1500); app_state_set_connected(false); app_state_set_mode(RadioMode::UNKNOWN); },
+      1, [](int) {} },
+    { "encoder_spin",
+      [] { baseState(14074000UL); displaySetTuneMarker(true); },
+      200, [](int i) { app_state_set_freq(14074000UL + (uint32_t)(i + 1) * 1000UL); } },
+    { "tune_cursor",
+      [] { baseState(7100000UL); displaySetTuneMarker(true); displaySetTuneSelect(true); },
+      50, [](int i) { displaySetTuneCursor((uint8_t)((i + 1) % 5)); } },
+    { "menu_nav",
+      [] { baseState(3573000UL); },
+      40, [](int i) { displaySetMenuIndex((uint8_t)((i + 1) % 4)); } },
+    { "mode_change",
+      [] { baseState(10136000UL); },
+      40, [](int i) { app_state_set_mode(MODES[(i + 1) % 4]); } },
+    { "busy_toggle",
+      [] { baseState(14074000UL); },
+      20, [](int i) { app_state_set_busy(i % 2 == 0); } },
+    { "mhz_cursor",
+      [] { baseState(30000000UL); displaySetTuneMarker(true); displaySetTuneCursor(0); },
+      3, [](int i) { displaySetTuneCursor((uint8_t)(i + 1)); } },
+    // offene Aktionen im Header: REMOTE an / Mode-Wechsel (endet mit "[LSB..]")
+    { "pending",
+      [] { baseState(7074000UL); },
+      20, [](int i) {
+        if (i % 2 == 0) {
+          app_state_set_desired_mode(RadioMode::USB);
+          app_state_set_link(RadioState::WAIT_CONNECT_ACK);
+        } else {
+          app_state_set_desired_mode(RadioMode::LSB);
+          app_state_set_link(RadioState::WAIT_SET_MODE_ACK);
+        }
+      } },
+  };
+}
+
+// ---------- Ablauf ----------
+static FrameSample renderFrame() {
+  auto t0 = std::chrono::steady_clock::now();
+  displayRender();
+  auto t1 = std::chrono::steady_clock::now();
+  DisplayFlushStats s = displayFlushStats();
+  return { std::chrono::duration<double, std::micro>(t1 - t0).count(), s.last_bytes, s.last_pages, s.last_layers };
+}
+
+static double pct(std::vector<double> v, double p) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[(size_t)(p * (v.size() - 1))];
+}
+
+static bool runScript(const Script& sc, bool firstPass, std::vector<FrameSample>& samples) {
+  sc.setup();
+  renderFrame();   // Ausgangszustand, nicht gezählt
+
+  for (int i = 0; i < sc.steps; i++) {
+    sc.step(i);
+    samples.push_back(renderFrame());
+    if (firstPass && opt.out) {
+      char name[96];
+      snprintf(name, sizeof(name), "%s/%s_%03d.pbm", opt.out, sc.name, i);
+      writeFile(name, toPbm(displayFramebuffer()));
+    }
+  }
+  if (!firstPass || !opt.golden) return true;
+
+  std::string path = std::string(opt.golden) + "/" + sc.name + ".pbm";
+  std::vector<uint8_t> img = toPbm(displayFramebuffer());
+  if (opt.update) return writeFile(path, img);
+
+  std::vector<uint8_t> ref;
+  if (!readFile(path, ref)) {
+    printf("%-13s golden missing: %s\n", sc.name, path.c_str());
+    return false;
+  }
+  int d = diffPixels(img, ref);
+  if (d == 0) return true;
+  printf("%-13s golden MISMATCH: %d pixels differ\n", sc.name, d);
+  writeFile(std::string(opt.golden) + "/" + sc.name + ".actual.pbm", img);
+  return false;
+}
+
+static void report(const char* name, const std::vector<FrameSample>& v) {
+  std::vector<double> us;
+  uint64_t bytes = 0;
+  uint16_t maxBytes = 0;
+  uint32_t layerCount[(uint8_t)DisplayLayer::COUNT] = {};
+  for (const FrameSample& f : v) {
+    us.push_back(f.render_us);
+    bytes += f.bytes;
+    maxBytes = std::max(maxBytes, f.bytes);
+    for (uint8_t l = 0; l < (uint8_t)DisplayLayer::COUNT; l++) layerCount[l] += (f.layers >> l) & 1;
+  }
+  double sum = 0;
+  for (double x : us) sum += x;
+  printf("%-13s frames=%-5zu render avg=%6.2f p50=%6.2f p95=%6.2f max=%7.2f us | bytes avg=%6.1f max=%4u"
+         " | redraws chrome=%u header=%u marker=%u freq=%u footer=%u\n",
+         name, v.size(), v.empty() ? 0 : sum / v.size(), pct(us, 0.5), pct(us, 0.95),
+         us.empty() ? 0 : *std::max_element(us.begin(), us.end()),
+         v.empty() ? 0 : (double)bytes / v.size(), maxBytes,
+         layerCount[0], layerCount[1], layerCount[2], layerCount[3], layerCount[4]);
+}
+
+// ---------- Frame-Pacing ----------
+// Echtzeit: spinMs lang eine Raste alle 1/velocity s, displayTick() wie in
+// loop() laufend. Ohne Pacing wird dieselbe Folge mit Geschwindigkeit 0
+// gemeldet (= fester UI_MIN_REFRESH_MS-Takt).
+struct PaceResult {
+  uint32_t detents = 0;
+  uint32_t frames = 0;
+  double render_ms = 0;      // Zeit in displayTick() während des Drehens
+  uint32_t bytes = 0;        // I2C-Bytes während des Drehens
+  double final_ms = -1;      // letzte Raste -> Frame mit dem Endwert
+};
+
+static uint64_t nowUs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static PaceResult pacingRun(uint16_t velocity, bool paced, uint32_t spinMs) {
+  baseState(14074000UL);
+  displaySetTuneMarker(true);
+  displayRender();
+  usleep((UI_PACE_SETTLE_MS + 50) * 1000);
+  displayTick();   // vorherigen Lauf abschließen
+
+  PaceResult r;
+  DisplayFlushStats s0 = displayFlushStats();
+  uint32_t v0 = displayFrameVersion();
+  uint32_t hz = 14074000UL;
+  const uint64_t periodUs = 1000000ULL / velocity;
+  const uint64_t start = nowUs();
+  uint64_t nextDetent = start, lastDetent = 0;
+  uint32_t versionAtLast = 0;
+
+  for (;;) {
+    uint64_t t = nowUs();
+    bool spinningNow = t - start < (uint64_t)spinMs * 1000;
+    if (!spinningNow && t - start > (uint64_t)(spinMs + 500) * 1000) break;
+
+    if (spinningNow && t >= nextDetent) {
+      hz += 1000;
+      app_state_set_freq(hz);
+      displayNoteInput(paced ? velocity : 0, 0);
+      nextDetent += periodUs;
+      lastDetent = t;
+      versionAtLast = displayFrameVersion();
+      r.detents++;
+    }
+
+    uint64_t t0 = nowUs();
+    displayTick();
+    if (spinningNow) r.render_ms += (nowUs() - t0) / 1000.0;
+
+    if (!spinningNow && r.final_ms < 0 && displayFrameVersion() != versionAtLast) {
+      r.final_ms = (nowUs() - lastDetent) / 1000.0;
+    }
+    usleep(200);
+  }
+
+  DisplayFlushStats s1 = displayFlushStats();
+  r.frames = displayFrameVersion() - v0;
+  r.bytes = s1.total_bytes - s0.total_bytes;
+  return r;
+}
+
+static void pacingReport() {
+  printf("frame pacing (real time, 2 s spin, then idle):\n");
+  for (uint16_t v : { (uint16_t)5, (uint16_t)20, (uint16_t)40 }) {
+    for (bool paced : { false, true }) {
+      PaceResult r = pacingRun(v, paced, 2000);
+      printf("  %2u detents/s %-6s detents=%-3u frames=%-3u render=%6.2f ms bytes=%-6u final frame after %.1f ms\n",
+             v, paced ? "paced" : "fixed", r.detents, r.frames, r.render_ms, r.bytes, r.final_ms);
+    }
+  }
+}
+
+// ---------- I2C-Vollbild ----------
+// Der Host-Wire zählt nur; die Zeit folgt aus den Bits auf dem Bus:
+// je Transaktion Start + Adressbyte + Stop, je Byte 8 Bit + ACK.
+// Software-Overhead pro Transaktion (ESP32-Treiber, Interrupts) fehlt, die
+// echte Messung liefert "display_bench" auf dem Gerät.
+static double busMs(uint32_t bytes, uint32_t txns, uint32_t hz) {
+  double bits = txns * (1.0 + 9.0 + 1.0) + bytes * 9.0;
+  return bits * 1000.0 / hz;
+}
+
+static void busReport() {
+  DisplayBusBench b = displayBusBench();
+  if (!b.ok) {
+    printf("bus: no frame\n");
+    return;
+  }
+  printf("full frame over I2C (computed from bus bits, no driver overhead):\n");
+  printf("  lean      %4u B %3u txn  %4u kHz: %6.2f ms   400 kHz: %6.2f ms\n",
+         b.lean_bytes, b.lean_txns, b.clock_hz / 1000,
+         busMs(b.lean_bytes, b.lean_txns, b.clock_hz), busMs(b.lean_bytes, b.lean_txns, 400000));
+  printf("  adafruit  %4u B %3u txn                        400 kHz: %6.2f ms\n",
+         b.adafruit_bytes, b.adafruit_txns, busMs(b.adafruit_bytes, b.adafruit_txns, 400000));
+}
+
+static bool parseArgs(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "--update") { opt.update = true; continue; }
+    if (a == "--pacing") { opt.pacing = true; continue; }
+    if (a == "--bus") { opt.bus = true; continue; }
+    if (i + 1 >= argc) return false;
+    const char* v = argv[++i];
+    if (a == "--golden") opt.golden = v;
+    else if (a == "--out") opt.out = v;
+    else if (a == "--repeat") opt.repeat = atoi(v);
+    else return false;
+  }
+  return opt.repeat > 0 && (!opt.update || opt.golden);
+}
+
+int main(int argc, char** argv) {
+  if (!parseArgs(argc, argv)) {
+    fprintf(stderr, "usage: %s [--golden DIR [--update]] [--out DIR] [--repeat N] [--pacing] [--bus]\n", argv[0]);
+    return 2;
+  }
+  Serial.attachFd(-1);   // Debug-Ausgaben der Display-Setter verwerfen
+  if (opt.out) mkdir(opt.out, 0755);
+
+  displayInit();
+
+  bool ok = true;
+  std::vector<Script> all = scripts();
+  for (const Script& sc : all) {
+    std::vector<FrameSample> samples;
+    for (int r = 0; r < opt.repeat; r++) ok = runScript(sc, r == 0, samples) && ok;
+    report(sc.name, samples);
+  }
+
+  DisplayFlushStats s = displayFlushStats();
+  printf("total: frames=%u full=%u skipped=%u bytes=%u i2c_txn=%u\n",
+         s.frames, s.full_frames, s.skipped_frames, s.total_bytes, s.transactions);
+  if (opt.golden && !opt.update) printf("golden: %s\n", ok ? "ok" : "FAILED");
+  if (opt.pacing) pacingReport();
+  if (opt.bus) busReport();
+  return ok ? 0 : 1;
+}
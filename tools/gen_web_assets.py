@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+# Web-Dateien aus web/ gzip-komprimiert in den Sketch übernehmen.
+#
+# Erzeugt web_assets.h / web_assets.cpp im Sketch-Ordner (die Arduino-IDE
+# kann beim Bauen kein Skript ausführen, deshalb liegen beide mit im Repo).
+# Nach jeder Änderung unter web/ neu laufen lassen:
+#
+#   python3 tools/gen_web_assets.py
+#
+# - *.html werden unter "/" (index.html) bzw. "/<name>" ausgeliefert und
+#   bei jedem Laden per ETag neu geprüft (304, wenn unverändert).
+# - CSS/JS bekommen in den HTML-Seiten ein ?v=<hash> angehängt und dürfen
+#   deshalb ein Jahr im Cache bleiben; geänderter Inhalt = neue URL.
+# - gzip mit festem Zeitstempel: gleicher Inhalt -> gleiche Bytes -> gleicher ETag.
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+
+TYPES = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css; charset=utf-8",
+    ".js": "application/javascript; charset=utf-8",
+}
+
+HEADER = """#pragma once
+#include <Arduino.h>
+
+// Statische Web-Dateien, gzip-komprimiert im Flash.
+// Erzeugt von tools/gen_web_assets.py aus web/ – nicht von Hand ändern.
+
+struct WebAsset {
+  const char* path;          // URL, z.B. "/" oder "/app.css"
+  const char* content_type;
+  const uint8_t* gz;         // PROGMEM, Content-Encoding: gzip
+  uint32_t gz_len;
+  const char* etag;          // starker ETag inkl. Anführungszeichen
+  bool immutable;            // per ?v=<hash> versioniert -> lange cachen
+};
+
+extern const WebAsset WEB_ASSETS[];
+extern const uint8_t WEB_ASSET_COUNT;
+"""
+
+
+def gzip_bytes(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def etag(data):
+    return hashlib.sha1(data).hexdigest()[:16]
+
+
+def url_for(name):
+    if name == "index.html":
+        return "/"
+    if name.endswith(".html"):
+        return "/" + name[: -len(".html")]
+    return "/" + name
+
+
+def c_ident(name):
+    return "WEB_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ",".join("0x%02x" % b for b in data[i : i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    names = sorted(n for n in os.listdir(WEB_DIR) if os.path.splitext(n)[1] in TYPES)
+    if "index.html" not in names:
+        sys.exit("web/index.html fehlt")
+
+    # Zuerst CSS/JS: deren Hash geht in die URLs der Seiten ein
+    assets = {}
+    for name in names:
+        if name.endswith(".html"):
+            continue
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            raw = f.read()
+        gz = gzip_bytes(raw)
+        assets[name] = (raw, gz, etag(gz), True)
+
+    for name in names:
+        if not name.endswith(".html"):
+            continue
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            html = f.read().decode("utf-8")
+        for dep, (_, _, tag, _) in assets.items():
+            html = html.replace('"/%s"' % dep, '"/%s?v=%s"' % (dep, tag[:8]))
+        raw = html.encode("utf-8")
+        gz = gzip_bytes(raw)
+        assets[name] = (raw, gz, etag(gz), False)
+
+    out = []
+    out.append("// Erzeugt von tools/gen_web_assets.py aus web/ – nicht von Hand ändern.")
+    out.append('#include "web_assets.h"')
+    out.append("")
+    total_raw = total_gz = 0
+    for name in names:
+        raw, gz, _, _ = assets[name]
+        total_raw += len(raw)
+        total_gz += len(gz)
+        out.append("// %s: %d -> %d Bytes" % (name, len(raw), len(gz)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % c_ident(name))
+        out.append(c_array(gz))
+        out.append("};")
+        out.append("")
+    out.append("const WebAsset WEB_ASSETS[] = {")
+    for name in names:
+        raw, gz, tag, immutable = assets[name]
+        ext = os.path.splitext(name)[1]
+        out.append('  { "%s", "%s", %s, %d, "\\"%s\\"", %s },' % (
+            url_for(name), TYPES[ext], c_ident(name), len(gz), tag,
+            "true" if immutable else "false"))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+
+    with open(os.path.join(ROOT, "web_assets.h"), "w", encoding="utf-8") as f:
+        f.write(HEADER)
+    with open(os.path.join(ROOT, "web_assets.cpp"), "w", encoding="utf-8") as f:
+        f.write("\n".join(out))
+
+    for name in names:
+        raw, gz, tag, _ = assets[name]
+        print("%-12s %6d -> %5d B  %s" % (name, len(raw), len(gz), url_for(name)))
+    print("%-12s %6d -> %5d B" % ("total", total_raw, total_gz))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,47 @@
+#pragma once
+// Host-Ersatz für Adafruit_GFX: die Teilmenge, die display_sh1107.cpp
+// benutzt, mit denselben Algorithmen (Bresenham, Rundrechteck, klassischer
+// 5x7-Font), damit Host-Bilder pixelgleich zum Gerät sind.
+#include "Arduino.h"
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  void setTextSize(uint8_t s) { textsize = s ? s : 1; }
+  void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+  void setTextWrap(bool w) { wrap = w; }
+  void getTextBounds(const char* s, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+
+  size_t write(const uint8_t* buf, size_t n) override;
+  using Print::write;
+
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+protected:
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color);
+
+  const int16_t WIDTH, HEIGHT;   // unrotiert
+  int16_t _width, _height;
+  int16_t cursor_x = 0, cursor_y = 0;
+  uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+  uint8_t textsize = 1;
+  uint8_t rotation = 0;
+  bool wrap = true;
+};
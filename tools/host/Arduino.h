@@ -0,0 +1,202 @@
+#pragma once
+// Minimaler Arduino-Ersatz für Host-Builds (Linux) der Sketch-Module.
+// Deckt nur ab, was radio_link & Co. tatsächlich benutzen.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <string>
+#include <utility>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define DEC 10
+#define HEX 16
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+class __FlashStringHelper;
+
+// ---------- String ----------
+class String {
+public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const __FlashStringHelper* s) : s_(reinterpret_cast<const char*>(s)) {}
+  String(const std::string& s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(long long v) : s_(std::to_string(v)) {}
+  String(unsigned long long v) : s_(std::to_string(v)) {}
+  String(double v, unsigned int decimals = 2) {
+    char b[40];
+    snprintf(b, sizeof(b), "%.*f", (int)decimals, v);
+    s_ = b;
+  }
+
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  const char* c_str() const { return s_.c_str(); }
+  bool reserve(unsigned int n) { s_.reserve(n); return true; }
+
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(int v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned int v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(long v) { s_ += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { s_ += std::to_string(v); return *this; }
+  bool concat(const char* p, unsigned int n) { s_.append(p, n); return true; }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.s_); }
+  friend String operator+(const String& a, char b) { return String(a.s_ + b); }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return s_ != o; }
+  char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char& operator[](unsigned int i) { return s_[i]; }
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+
+  String substring(unsigned int from) const {
+    return from < s_.size() ? String(s_.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    return from < s_.size() ? String(s_.substr(from, to - from)) : String();
+  }
+  int indexOf(char c, unsigned int from = 0) const { return pos(s_.find(c, from)); }
+  int indexOf(const String& o, unsigned int from = 0) const { return pos(s_.find(o.s_, from)); }
+  int indexOf(const char* o, unsigned int from = 0) const { return pos(s_.find(o, from)); }
+  bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+  bool endsWith(const String& p) const {
+    return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+  }
+  bool equalsIgnoreCase(const String& o) const {
+    if (o.s_.size() != s_.size()) return false;
+    for (size_t i = 0; i < s_.size(); i++) {
+      if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+    }
+    return true;
+  }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  void trim() {
+    size_t b = 0, e = s_.size();
+    while (b < e && isspace((unsigned char)s_[b])) b++;
+    while (e > b && isspace((unsigned char)s_[e - 1])) e--;
+    s_ = s_.substr(b, e - b);
+  }
+  void remove(unsigned int i) { if (i < s_.size()) s_.erase(i); }
+  void remove(unsigned int i, unsigned int n) { if (i < s_.size()) s_.erase(i, n); }
+  void toLowerCase() { for (auto& c : s_) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (auto& c : s_) c = (char)toupper((unsigned char)c); }
+
+private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  std::string s_;
+};
+
+// ---------- Print / Stream ----------
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t* buf, size_t n) = 0;
+  size_t write(uint8_t b) { return write(&b, 1); }
+
+  size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const __FlashStringHelper* s) { return print(reinterpret_cast<const char*>(s)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return print(String(v)); }
+  size_t print(unsigned int v) { return print(String(v)); }
+  size_t print(long v) { return print(String(v)); }
+  size_t print(unsigned long v) { return print(String(v)); }
+  size_t print(double v, int d = 2) { return print(String(v, (unsigned int)d)); }
+
+  size_t println() { return print("\r\n"); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+
+  int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+};
+
+// Serielle Schnittstelle auf einem Datei-Deskriptor (stdout, pty, tty)
+class HardwareSerial : public Stream {
+public:
+  explicit HardwareSerial(int fd = -1) : fd_(fd) {}
+  void begin(unsigned long baud, uint32_t config = 0, int8_t rxPin = -1, int8_t txPin = -1);
+  void end();
+  int available() override;
+  int read() override;
+  size_t write(const uint8_t* buf, size_t n) override;
+  using Print::write;
+
+  // Host: an Pfad (z.B. pty des Simulators) binden; -1 = Ausgabe verwerfen
+  bool attach(const char* path);
+  void attachFd(int fd) { fd_ = fd; }
+
+private:
+  int fd_;
+};
+
+#define SERIAL_8N1 0x800001c
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+// ---------- Zeit ----------
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// ---------- GPIO (nur damit Module linken) ----------
+#define INPUT 0x01
+#define INPUT_PULLUP 0x05
+#define OUTPUT 0x03
+#define HIGH 1
+#define LOW 0
+#define CHANGE 3
+inline void pinMode(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+struct EspClass {
+  void restart() { exit(0); }
+};
+extern EspClass ESP;
+
+// ---------- FreeRTOS (nur Typen; Tasks starten nie -> Module laufen synchron) ----------
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef struct { int unused; } portMUX_TYPE;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portMUX_INITIALIZER_UNLOCKED {0}
+inline void portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void portEXIT_CRITICAL(portMUX_TYPE*) {}
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void*), const char*, uint32_t, void*,
+                                          UBaseType_t, TaskHandle_t*, BaseType_t) { return pdFAIL; }
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+inline BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
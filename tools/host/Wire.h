@@ -0,0 +1,33 @@
+#pragma once
+// Host-Ersatz für Wire: sendet nichts, zählt Transaktionen und Bytes
+// (ohne Adressbyte), Puffergröße wie beim ESP32 einstellbar.
+#include "Arduino.h"
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t freq = 0) { (void)sda; (void)scl; (void)freq; return true; }
+  bool setClock(uint32_t hz) { clock = hz; return true; }
+  uint32_t getClock() const { return clock; }
+  size_t setBufferSize(size_t n) { bufferSize = n; return n; }
+
+  void beginTransmission(uint8_t) { pending = 0; }
+  size_t write(uint8_t) { return put(1); }
+  size_t write(const uint8_t*, size_t n) { return put(n); }
+  uint8_t endTransmission(bool = true) {
+    transactions++;
+    bytes += pending;
+    return overflow() ? 1 : 0;   // ESP32: Daten jenseits des Puffers gehen verloren
+  }
+
+  uint32_t clock = 100000;
+  size_t bufferSize = 128;
+  uint32_t transactions = 0;
+  uint32_t bytes = 0;
+
+private:
+  size_t pending = 0;
+  size_t put(size_t n) { pending += n; return n; }
+  bool overflow() const { return pending > bufferSize; }
+};
+
+extern TwoWire Wire;
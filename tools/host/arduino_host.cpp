@@ -0,0 +1,102 @@
+// Host-Implementierung des Arduino-Ersatzes (Linux).
+#include "Arduino.h"
+
+#include <cstdarg>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+HardwareSerial Serial(STDOUT_FILENO);
+HardwareSerial Serial2(-1);
+EspClass ESP;
+
+// ---------- Zeit ----------
+static uint64_t monotonicUs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+static const uint64_t T0 = monotonicUs();
+
+unsigned long millis() { return (unsigned long)((monotonicUs() - T0) / 1000ULL); }
+unsigned long micros() { return (unsigned long)(monotonicUs() - T0); }
+void delay(unsigned long ms) { usleep((useconds_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { usleep(us); }
+
+// ---------- Print ----------
+int Print::printf(const char* fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n > 0) write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+  return n;
+}
+
+// ---------- HardwareSerial ----------
+static speed_t toSpeed(unsigned long baud) {
+  switch (baud) {
+    case 9600:   return B9600;
+    case 19200:  return B19200;
+    case 38400:  return B38400;
+    case 57600:  return B57600;
+    case 115200: return B115200;
+    default:     return B19200;
+  }
+}
+
+bool HardwareSerial::attach(const char* path) {
+  fd_ = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd_ < 0) {
+    perror(path);
+    return false;
+  }
+  termios t;
+  if (tcgetattr(fd_, &t) == 0) {
+    cfmakeraw(&t);
+    tcsetattr(fd_, TCSANOW, &t);
+  }
+  return true;
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t, int8_t, int8_t) {
+  if (fd_ < 0 || !isatty(fd_) || fd_ == STDOUT_FILENO) return;
+  termios t;
+  if (tcgetattr(fd_, &t) != 0) return;
+  cfsetispeed(&t, toSpeed(baud));
+  cfsetospeed(&t, toSpeed(baud));
+  tcsetattr(fd_, TCSANOW, &t);
+}
+
+void HardwareSerial::end() {
+  if (fd_ > STDERR_FILENO) close(fd_);
+  fd_ = -1;
+}
+
+int HardwareSerial::available() {
+  if (fd_ < 0 || fd_ == STDOUT_FILENO) return 0;
+  int n = 0;
+  if (ioctl(fd_, FIONREAD, &n) != 0) return 0;
+  return n;
+}
+
+int HardwareSerial::read() {
+  if (fd_ < 0) return -1;
+  uint8_t c;
+  return (::read(fd_, &c, 1) == 1) ? c : -1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+  if (fd_ < 0) return n;  // verwerfen
+  size_t done = 0;
+  while (done < n) {
+    ssize_t w = ::write(fd_, buf + done, n - done);
+    if (w > 0) done += (size_t)w;
+    else usleep(100);
+  }
+  return n;
+}
@@ -0,0 +1,163 @@
+// Host-Implementierung von Adafruit_GFX (Linux) und das Wire-Objekt.
+// Zeichenroutinen folgen dem Original, damit Golden Images vom Host dem
+// Gerät entsprechen.
+#include "Adafruit_GFX.h"
+#include "Wire.h"
+
+#include <algorithm>
+
+TwoWire Wire;
+
+// Klassischer 5x7-Font (glcdfont), ASCII 0x20..0x7E; Spalten, Bit 0 = oben
+static const uint8_t FONT[95][5] = {
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},  //  !"#
+  {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x56,0x20,0x50}, {0x00,0x08,0x07,0x03,0x00},  // $%&'
+  {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08},  // ()*+
+  {0x00,0x80,0x70,0x30,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x00,0x60,0x60,0x00}, {0x20,0x10,0x08,0x04,0x02},  // ,-./
+  {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x72,0x49,0x49,0x49,0x46}, {0x21,0x41,0x49,0x4D,0x33},  // 0123
+  {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x31}, {0x41,0x21,0x11,0x09,0x07},  // 4567
+  {0x36,0x49,0x49,0x49,0x36}, {0x46,0x49,0x49,0x29,0x1E}, {0x00,0x00,0x14,0x00,0x00}, {0x00,0x40,0x34,0x00,0x00},  // 89:;
+  {0x00,0x08,0x14,0x22,0x41}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x59,0x09,0x06},  // <=>?
+  {0x3E,0x41,0x5D,0x59,0x4E}, {0x7C,0x12,0x11,0x12,0x7C}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},  // @ABC
+  {0x7F,0x41,0x41,0x41,0x3E}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x41,0x51,0x73},  // DEFG
+  {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},  // HIJK
+  {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x1C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},  // LMNO
+  {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x26,0x49,0x49,0x49,0x32},  // PQRS
+  {0x03,0x01,0x7F,0x01,0x03}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},  // TUVW
+  {0x63,0x14,0x08,0x14,0x63}, {0x03,0x04,0x78,0x04,0x03}, {0x61,0x59,0x49,0x4D,0x43}, {0x00,0x7F,0x41,0x41,0x41},  // XYZ[
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x41,0x7F}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},  // \]^_
+  {0x00,0x03,0x07,0x08,0x00}, {0x20,0x54,0x54,0x78,0x40}, {0x7F,0x28,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x28},  // `abc
+  {0x38,0x44,0x44,0x28,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x00,0x08,0x7E,0x09,0x02}, {0x18,0xA4,0xA4,0x9C,0x78},  // defg
+  {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x40,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},  // hijk
+  {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x78,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},  // lmno
+  {0xFC,0x18,0x24,0x24,0x18}, {0x18,0x24,0x24,0x18,0xFC}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x24},  // pqrs
+  {0x04,0x04,0x3F,0x44,0x24}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},  // tuvw
+  {0x44,0x28,0x10,0x28,0x44}, {0x4C,0x90,0x90,0x90,0x7C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},  // xyz{
+  {0x00,0x00,0x77,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x02,0x01,0x02,0x04,0x02},                              // |}~
+};
+
+// ---------- Adafruit_GFX ----------
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  bool swap = rotation & 1;
+  _width = swap ? HEIGHT : WIDTH;
+  _height = swap ? WIDTH : HEIGHT;
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  drawLine(x, y, x + w - 1, y, color);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  drawLine(x, y, x, y + h - 1, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+  if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+
+  int16_t dx = x1 - x0, dy = (int16_t)abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) drawPixel(y0, x0, color);
+    else       drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) { y0 += ystep; err += dx; }
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) drawFastVLine(i, y, h, color);
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                                    int16_t delta, uint16_t color) {
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r;
+  int16_t x = 0, y = r, px = x, py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1)) {
+      if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  int16_t maxR = ((w < h) ? w : h) / 2;
+  if (r > maxR) r = maxR;
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  if (x >= _width || y >= _height || (x + 6 * size - 1) < 0 || (y + 8 * size - 1) < 0) return;
+  const uint8_t* glyph = (c >= 0x20 && c <= 0x7E) ? FONT[c - 0x20] : FONT[0];
+
+  for (int8_t i = 0; i < 5; i++) {
+    uint8_t line = glyph[i];
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if (line & 1) {
+        if (size == 1) drawPixel(x + i, y + j, color);
+        else fillRect(x + i * size, y + j * size, size, size, color);
+      } else if (bg != color) {
+        if (size == 1) drawPixel(x + i, y + j, bg);
+        else fillRect(x + i * size, y + j * size, size, size, bg);
+      }
+    }
+  }
+  if (bg != color) {
+    if (size == 1) drawFastVLine(x + 5, y, 8, bg);
+    else fillRect(x + 5 * size, y, size, 8 * size, bg);
+  }
+}
+
+size_t Adafruit_GFX::write(const uint8_t* buf, size_t n) {
+  for (size_t k = 0; k < n; k++) {
+    uint8_t c = buf[k];
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize * 8;
+    } else if (c != '\r') {
+      if (wrap && (cursor_x + textsize * 6) > _width) {
+        cursor_x = 0;
+        cursor_y += textsize * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+      cursor_x += textsize * 6;
+    }
+  }
+  return n;
+}
+
+void Adafruit_GFX::getTextBounds(const char* s, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+                                 uint16_t* w, uint16_t* h) {
+  // Ohne Umbruch: wie das Original für einzeilige Texte im eingebauten Font
+  size_t n = strlen(s);
+  *x1 = x;
+  *y1 = y;
+  *w = n ? (uint16_t)(n * 6 * textsize) : 0;
+  *h = n ? (uint16_t)(8 * textsize) : 0;
+}
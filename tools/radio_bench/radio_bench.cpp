@@ -0,0 +1,198 @@
+// Host-Benchmark für radio_link.cpp gegen radio_sim (oder ein echtes Radio).
+//
+// Misst Handshake-Zeiten, Durchsatz und Latenz (Aufruf -> TX, Aufruf -> ACK)
+// einer Folge von radio_send_freq()-Aufrufen sowie optional Verlust-
+// erkennung und Wiederverbinden (Simulator per SIGUSR1 aus/ein).
+//
+// Build:
+//   g++ -std=gnu++17 -O2 -Itools/host -I. -o tools/bin/radio_bench
+//       tools/radio_bench/radio_bench.cpp tools/host/arduino_host.cpp
+//       radio_link.cpp app_state.cpp config.cpp telemetry.cpp
+// Start:
+//   tools/bin/radio_sim --link /tmp/m3radio --latency 20 &
+//   tools/bin/radio_bench --port /tmp/m3radio --count 200 --interval 0 --sim-pid $!
+
+#include "Arduino.h"
+#include "radio_link.h"
+#include "app_state.h"
+
+#include <algorithm>
+#include <csignal>
+#include <functional>
+#include <vector>
+
+#include <unistd.h>
+
+struct BenchOptions {
+  const char* port = "/tmp/m3radio";
+  int count = 100;
+  int interval_ms = 0;       // 0 = Burst
+  bool telemetry = false;
+  bool retry = false;        // bei QUEUE_FULL radio_retry_after_ms() warten statt verwerfen
+  pid_t sim_pid = 0;         // > 0: Verlusttest per SIGUSR1
+  bool verbose = false;
+};
+
+struct Cmd {
+  uint32_t issued_us = 0;
+  uint32_t tx_us = 0;
+  uint32_t ack_us = 0;
+  bool dropped = false;
+};
+
+static BenchOptions opt;
+
+static bool runUntil(const std::function<bool()>& cond, uint32_t timeoutMs) {
+  uint32_t t0 = millis();
+  while (!cond()) {
+    if (millis() - t0 > timeoutMs) return false;
+    radio_loop();
+    usleep(100);
+  }
+  return true;
+}
+
+static void printPercentiles(const char* name, std::vector<uint32_t> v) {
+  if (v.empty()) {
+    printf("  %-14s n=0\n", name);
+    return;
+  }
+  std::sort(v.begin(), v.end());
+  auto pct = [&](double p) { return v[(size_t)(p * (v.size() - 1))] / 1000.0; };
+  double sum = 0;
+  for (uint32_t x : v) sum += x;
+  printf("  %-14s n=%zu min=%.2f avg=%.2f p50=%.2f p95=%.2f max=%.2f ms\n",
+         name, v.size(), v.front() / 1000.0, sum / v.size() / 1000.0, pct(0.5), pct(0.95), v.back() / 1000.0);
+}
+
+static bool parseArgs(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "-v") { opt.verbose = true; continue; }
+    if (a == "--telemetry") { opt.telemetry = true; continue; }
+    if (a == "--retry") { opt.retry = true; continue; }
+    if (i + 1 >= argc) return false;
+    const char* v = argv[++i];
+    if (a == "--port") opt.port = v;
+    else if (a == "--count") opt.count = atoi(v);
+    else if (a == "--interval") opt.interval_ms = atoi(v);
+    else if (a == "--sim-pid") opt.sim_pid = (pid_t)atoi(v);
+    else return false;
+  }
+  return opt.count > 0;
+}
+
+int main(int argc, char** argv) {
+  if (!parseArgs(argc, argv)) {
+    fprintf(stderr, "usage: %s [--port PATH] [--count N] [--interval MS] [--telemetry] [--retry] [--sim-pid PID] [-v]\n", argv[0]);
+    return 2;
+  }
+  if (!opt.verbose) Serial.attachFd(-1);   // Debug-Ausgaben von radio_link verwerfen
+  if (!Serial2.attach(opt.port)) return 1;
+
+  // ---------- Handshake ----------
+  uint32_t t0 = millis();
+  radio_init();
+  radio_telemetry_enable(opt.telemetry);
+  if (!runUntil([] { return app_state().link == RadioState::COM_PORT_IS_OPEN; }, 5000)) {
+    fprintf(stderr, "no open ack\n");
+    return 1;
+  }
+  uint32_t openMs = millis() - t0;
+
+  t0 = millis();
+  radio_send_connect();
+  if (!runUntil(radio_is_ready, 5000)) {
+    fprintf(stderr, "no connect ack\n");
+    return 1;
+  }
+  uint32_t connectMs = millis() - t0;
+
+  // ---------- Frequenzfolge ----------
+  std::vector<Cmd> cmds((size_t)opt.count);
+  size_t nextTx = 0, nextAck = 0;
+  RadioLinkStats s = radio_link_stats();
+  uint32_t txSeen = s.tx_frames, rxSeen = s.rx_lines;
+
+  // TX/ACK in Reihenfolge den Aufrufen zuordnen (Telemetrie aus, sonst verfälscht)
+  auto track = [&]() {
+    RadioLinkStats now = radio_link_stats();
+    uint32_t us = micros();
+    for (; txSeen < now.tx_frames; txSeen++) {
+      while (nextTx < cmds.size() && (cmds[nextTx].dropped || !cmds[nextTx].issued_us)) nextTx++;
+      if (nextTx < cmds.size()) cmds[nextTx++].tx_us = us;
+    }
+    for (; rxSeen < now.rx_lines; rxSeen++) {
+      while (nextAck < nextTx && cmds[nextAck].dropped) nextAck++;
+      if (nextAck < nextTx) cmds[nextAck++].ack_us = us;
+    }
+  };
+
+  uint32_t startUs = micros();
+  uint32_t nextIssueMs = millis();
+  size_t retries = 0;
+  for (size_t i = 0; i < cmds.size();) {
+    if (millis() >= nextIssueMs) {
+      if (!cmds[i].issued_us) cmds[i].issued_us = micros();
+      RadioAdmit a = radio_send_freq(7000000UL + (uint32_t)i * 1000UL);
+      if (opt.retry && a == RadioAdmit::QUEUE_FULL) {
+        // Gegendruck befolgen: gleicher Befehl nach Retry-After
+        retries++;
+        nextIssueMs = millis() + radio_retry_after_ms();
+      } else {
+        cmds[i].dropped = !radio_admit_ok(a);
+        i++;
+        nextIssueMs += (uint32_t)opt.interval_ms;
+      }
+    }
+    radio_loop();
+    track();
+    if (opt.interval_ms) usleep(100);
+  }
+  auto allAcked = [&] {
+    track();
+    for (const Cmd& c : cmds) if (!c.dropped && !c.ack_us) return false;
+    return true;
+  };
+  runUntil(allAcked, 3000);
+
+  std::vector<uint32_t> queueWait, roundTrip;
+  size_t dropped = 0, acked = 0;
+  uint32_t endUs = startUs;
+  for (const Cmd& c : cmds) {
+    if (c.dropped) { dropped++; continue; }
+    if (c.tx_us) queueWait.push_back(c.tx_us - c.issued_us);
+    if (c.ack_us) {
+      roundTrip.push_back(c.ack_us - c.issued_us);
+      acked++;
+      if ((int32_t)(c.ack_us - endUs) > 0) endUs = c.ack_us;
+    }
+  }
+  double secs = (endUs - startUs) / 1e6;
+
+  printf("handshake: open=%u ms connect=%u ms\n", openMs, connectMs);
+  printf("freq: issued=%d dropped(queue full)=%zu retries=%zu acked=%zu in %.3f s -> %.1f cmd/s\n",
+         opt.count, dropped, retries, acked, secs, acked / secs);
+  printPercentiles("call->tx", queueWait);
+  printPercentiles("call->ack", roundTrip);
+
+  // Wunsch gegen Radio: letzter angenommener Wert muss bestätigt sein
+  bool confirmed = runUntil([] { return app_state_freq_confirmed(app_state()); }, 2000);
+  RadioLinkStats fl = radio_link_stats();
+  printf("freq: desired=%u radio=%u confirmed=%s resends=%u give_ups=%u\n",
+         app_state().freq_hz, app_state().freq_radio_hz, confirmed ? "yes" : "NO",
+         fl.freq_resends, fl.freq_give_ups);
+
+  // ---------- Verlust / Wiederverbinden ----------
+  if (opt.sim_pid > 0) {
+    kill(opt.sim_pid, SIGUSR1);   // Funkgerät aus
+    bool lost = runUntil([] { return radio_link_stats().lost; }, 10000);
+    usleep(500 * 1000);
+    kill(opt.sim_pid, SIGUSR1);   // wieder an
+    bool back = lost && runUntil([] { return !radio_link_stats().lost && radio_is_ready(); }, 10000);
+    RadioLinkStats l = radio_link_stats();
+    printf("loss: detected=%s detect=%u ms | reconnect=%s %u ms (incl. 500 ms off)\n",
+           lost ? "yes" : "NO", l.last_detect_ms, back ? "yes" : "NO", l.last_reconnect_ms);
+  }
+  return 0;
+}
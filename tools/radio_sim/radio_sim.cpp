@@ -0,0 +1,404 @@
+// DM-Protokoll-Simulator für radio_link.cpp auf einem Pseudo-Terminal (Linux).
+//
+// Spricht das Protokoll so, wie radio_link.cpp es erwartet:
+//   "\nO\r"                      -> "o"
+//   "\nDM:REMOTE SENTER2,0\r"    -> "ds"   (SENTER0 ohne Remote -> "ds100ENTER")
+//   "\nDM:FF SRF<hz>;TF<hz>\r"   -> "ds"
+//   "\nDM:FF GRF;TF\r"           -> "dgRF<hz>;TF<hz>"
+//   "\nDM:FF SMD<n>\r"           -> "ds",   "FF GMD" -> "dgMD<n>"
+//   "\nDM:GR SPRS<n>\r"          -> "ds",   "GR GPRS" -> "dgPRS<n>"
+//   "\nDM:FF GRS|GTP|GSW\r"      -> "dgRS<v>" / "dgTP<v>" / "dgSW<v>" (Telemetrie)
+// Antworten werden als "\n<antwort>\r" gesendet.
+//
+// Build:  g++ -std=gnu++17 -O2 -o tools/bin/radio_sim tools/radio_sim/radio_sim.cpp
+// Start:  tools/bin/radio_sim --link /tmp/m3radio --latency 20 --jitter 10 --drop 0.01
+//
+// SIGUSR1 schaltet das "Funkgerät" aus/ein (Link-Verlust testen).
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+struct Options {
+  const char* link = nullptr;    // Symlink auf den pty-Slave
+  uint32_t baud = 19200;         // Ausgabetakt (10 Bit pro Byte)
+  uint32_t latency_ms = 15;      // Antwortverzögerung
+  uint32_t jitter_ms = 0;        // +/- gleichverteilt
+  double drop = 0.0;             // Wahrscheinlichkeit: Antwort fehlt
+  double garbage = 0.0;          // Wahrscheinlichkeit: Störbytes vor der Antwort
+  uint32_t seed = 1;
+  uint32_t off_after_ms = 0;     // geplanter Ausfall ab Start (0 = nie)
+  uint32_t off_for_ms = 0;       // Dauer des Ausfalls
+  bool verbose = false;
+};
+
+struct Radio {
+  bool powered = true;
+  bool open = false;
+  bool remote = false;
+  uint32_t rx_hz = 14074000;
+  uint32_t tx_hz = 14074000;
+  int mode = 12;          // J3E+ (USB)
+  int preset = 0;
+  int smeter = 40;
+  int txpower = 0;
+  int swr = 110;          // x100
+};
+
+struct Reply {
+  uint64_t due_us;
+  std::string bytes;
+};
+
+struct Stats {
+  uint64_t frames = 0;
+  uint64_t replies = 0;
+  uint64_t dropped = 0;
+  uint64_t garbage = 0;
+  uint64_t ignored_off = 0;
+  uint64_t bytes_out = 0;
+};
+
+static Options opt;
+static Radio radio;
+static Stats stats;
+static std::mt19937 rng;
+static std::deque<Reply> replies;
+static std::string outBuf;
+static uint64_t lastDueUs = 0;
+
+static volatile sig_atomic_t g_stop = 0;
+static volatile sig_atomic_t g_togglePower = 0;
+
+static uint64_t nowUs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+static bool chance(double p) {
+  if (p <= 0.0) return false;
+  return std::uniform_real_distribution<double>(0.0, 1.0)(rng) < p;
+}
+
+static void logf(const char* fmt, const std::string& s) {
+  if (!opt.verbose) return;
+  std::string shown;
+  for (char c : s) {
+    if (c == '\n') shown += "<LF>";
+    else if (c == '\r') shown += "<CR>";
+    else shown += c;
+  }
+  fprintf(stderr, fmt, shown.c_str());
+}
+
+// ---------- Antworten ----------
+static void reply(const std::string& payload) {
+  if (chance(opt.drop)) {
+    stats.dropped++;
+    logf("[sim] drop   %s\n", payload);
+    return;
+  }
+
+  std::string bytes;
+  if (chance(opt.garbage)) {
+    stats.garbage++;
+    int n = std::uniform_int_distribution<int>(1, 8)(rng);
+    for (int i = 0; i < n; i++) bytes += (char)std::uniform_int_distribution<int>(0x21, 0x7E)(rng);
+    if (chance(0.5)) bytes += '\r';   // Störzeile
+  }
+  bytes += "\n" + payload + "\r";
+
+  int64_t delay = (int64_t)opt.latency_ms * 1000;
+  if (opt.jitter_ms) {
+    delay += std::uniform_int_distribution<int64_t>(-(int64_t)opt.jitter_ms * 1000,
+                                                    (int64_t)opt.jitter_ms * 1000)(rng);
+  }
+  if (delay < 0) delay = 0;
+
+  // Ein echtes Funkgerät antwortet in Reihenfolge
+  uint64_t due = nowUs() + (uint64_t)delay;
+  if (due < lastDueUs) due = lastDueUs;
+  lastDueUs = due;
+
+  replies.push_back({due, bytes});
+  stats.replies++;
+  logf("[sim] reply  %s\n", payload);
+}
+
+// ---------- Befehle ----------
+static std::string trim(const std::string& s) {
+  size_t b = s.find_first_not_of(' ');
+  size_t e = s.find_last_not_of(' ');
+  return (b == std::string::npos) ? "" : s.substr(b, e - b + 1);
+}
+
+static std::vector<std::string> split(const std::string& s, char sep) {
+  std::vector<std::string> out;
+  size_t start = 0;
+  while (true) {
+    size_t p = s.find(sep, start);
+    out.push_back(trim(s.substr(start, p == std::string::npos ? std::string::npos : p - start)));
+    if (p == std::string::npos) break;
+    start = p + 1;
+  }
+  return out;
+}
+
+static uint32_t toU32(const std::string& s) {
+  return (uint32_t)strtoul(trim(s).c_str(), nullptr, 10);
+}
+
+static void walkTelemetry() {
+  radio.smeter += std::uniform_int_distribution<int>(-3, 3)(rng);
+  if (radio.smeter < 0) radio.smeter = 0;
+  if (radio.smeter > 120) radio.smeter = 120;
+  radio.swr = 100 + std::uniform_int_distribution<int>(0, 40)(rng);
+}
+
+// "FF SRF14074000;TF14074000", "FF GRF;TF", "FF SRF 7030000"
+static void handleFF(const std::string& body) {
+  std::vector<std::string> toks = split(body, ';');
+  char op = 0;
+  std::string answer;
+
+  for (size_t i = 0; i < toks.size(); i++) {
+    std::string t = toks[i];
+    if (i == 0) {
+      if (t.empty() || (t[0] != 'S' && t[0] != 'G')) { reply("de"); return; }
+      op = t[0];
+      t = t.substr(1);
+    }
+    if (t.size() < 2) { reply("de"); return; }
+    std::string key = t.substr(0, 2);
+    std::string val = t.substr(2);
+
+    if (op == 'S') {
+      if (!radio.remote) { reply("de"); return; }
+      if (key == "RF") radio.rx_hz = toU32(val);
+      else if (key == "TF") radio.tx_hz = toU32(val);
+      else if (key == "MD") radio.mode = (int)toU32(val);
+      else { reply("de"); return; }
+    } else {
+      std::string v;
+      if (key == "RF") v = std::to_string(radio.rx_hz);
+      else if (key == "TF") v = std::to_string(radio.tx_hz);
+      else if (key == "MD") v = std::to_string(radio.mode);
+      else if (key == "RS") { walkTelemetry(); v = std::to_string(radio.smeter); }
+      else if (key == "TP") v = std::to_string(radio.txpower);
+      else if (key == "SW") v = std::to_string(radio.swr);
+      else { reply("de"); return; }
+      if (!answer.empty()) answer += ';';
+      answer += key + v;
+    }
+  }
+  reply(op == 'S' ? "ds" : "dg" + answer);
+}
+
+static void handleGR(const std::string& body) {
+  std::string b = trim(body);
+  if (b.rfind("SPRS", 0) == 0) {
+    if (!radio.remote) { reply("de"); return; }
+    radio.preset = (int)toU32(b.substr(4));
+    reply("ds");
+  } else if (b == "GPRS") {
+    reply("dgPRS" + std::to_string(radio.preset));
+  } else {
+    reply("de");
+  }
+}
+
+static void handleFrame(const std::string& frame) {
+  stats.frames++;
+  logf("[sim] frame  %s\n", frame);
+
+  if (frame == "O") {
+    radio.open = true;
+    reply("o");
+    return;
+  }
+  if (!radio.open) return;                 // ohne OPEN keine DM-Befehle
+  if (frame.rfind("DM:", 0) != 0) { reply("de"); return; }
+
+  std::string cmd = frame.substr(3);
+  if (cmd.rfind("REMOTE SENTER", 0) == 0) {
+    std::string arg = trim(cmd.substr(13));
+    if (arg == "0") {
+      if (!radio.remote) { reply("ds100ENTER"); return; }
+      radio.remote = false;
+    } else {
+      radio.remote = true;
+    }
+    reply("ds");
+  } else if (cmd.rfind("FF ", 0) == 0) {
+    handleFF(cmd.substr(3));
+  } else if (cmd.rfind("GR ", 0) == 0) {
+    handleGR(cmd.substr(3));
+  } else {
+    reply("de");
+  }
+}
+
+// ---------- Ein/Aus ----------
+static void setPower(bool on) {
+  if (radio.powered == on) return;
+  radio.powered = on;
+  if (!on) {
+    radio.open = false;
+    radio.remote = false;
+    replies.clear();
+    outBuf.clear();
+  }
+  fprintf(stderr, "[sim] power %s\n", on ? "ON" : "OFF");
+}
+
+static void onSignal(int sig) {
+  if (sig == SIGUSR1) g_togglePower = 1;
+  else g_stop = 1;
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s [--link PATH] [--baud N] [--latency MS] [--jitter MS]\n"
+          "          [--drop P] [--garbage P] [--seed N]\n"
+          "          [--off-after MS --off-for MS] [-v]\n", argv0);
+}
+
+static bool parseArgs(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : nullptr; };
+    const char* v = nullptr;
+    if (a == "-v") { opt.verbose = true; continue; }
+    if (a == "-h" || a == "--help") return false;
+    if (!(v = next())) return false;
+    if (a == "--link") opt.link = v;
+    else if (a == "--baud") opt.baud = (uint32_t)atoi(v);
+    else if (a == "--latency") opt.latency_ms = (uint32_t)atoi(v);
+    else if (a == "--jitter") opt.jitter_ms = (uint32_t)atoi(v);
+    else if (a == "--drop") opt.drop = atof(v);
+    else if (a == "--garbage") opt.garbage = atof(v);
+    else if (a == "--seed") opt.seed = (uint32_t)atoi(v);
+    else if (a == "--off-after") opt.off_after_ms = (uint32_t)atoi(v);
+    else if (a == "--off-for") opt.off_for_ms = (uint32_t)atoi(v);
+    else return false;
+  }
+  return opt.baud > 0;
+}
+
+int main(int argc, char** argv) {
+  if (!parseArgs(argc, argv)) {
+    usage(argv[0]);
+    return 2;
+  }
+  rng.seed(opt.seed);
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    perror("posix_openpt");
+    return 1;
+  }
+  const char* slavePath = ptsname(master);
+
+  // Raw-Modus gilt für beide Seiten; den Slave offen halten, damit der
+  // Master beim Schließen des Clients kein EIO liefert.
+  termios t;
+  tcgetattr(master, &t);
+  cfmakeraw(&t);
+  tcsetattr(master, TCSANOW, &t);
+  int keepSlave = open(slavePath, O_RDWR | O_NOCTTY);
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+  if (opt.link) {
+    unlink(opt.link);
+    if (symlink(slavePath, opt.link) != 0) perror("symlink");
+  }
+  printf("pty: %s%s%s\n", slavePath, opt.link ? " -> " : "", opt.link ? opt.link : "");
+  fflush(stdout);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGUSR1, onSignal);
+
+  const uint64_t byteUs = 10ULL * 1000000ULL / opt.baud;
+  const uint64_t startUs = nowUs();
+  uint64_t nextByteUs = startUs;
+  bool inFrame = false;
+  std::string frame;
+
+  while (!g_stop) {
+    uint64_t now = nowUs();
+
+    if (g_togglePower) {
+      g_togglePower = 0;
+      setPower(!radio.powered);
+    }
+    if (opt.off_after_ms) {
+      uint64_t t = (now - startUs) / 1000ULL;
+      bool off = t >= opt.off_after_ms && t < (uint64_t)opt.off_after_ms + opt.off_for_ms;
+      setPower(!off);
+    }
+
+    // --- Eingang ---
+    uint8_t buf[256];
+    ssize_t n = read(master, buf, sizeof(buf));
+    for (ssize_t i = 0; i < n; i++) {
+      char c = (char)buf[i];
+      if (!radio.powered) { stats.ignored_off++; continue; }
+      if (c == '\n') { inFrame = true; frame.clear(); continue; }
+      if (c == '\r') {
+        if (inFrame) handleFrame(frame);
+        inFrame = false;
+        continue;
+      }
+      if (inFrame && frame.size() < 200) frame += c;
+    }
+
+    // --- fällige Antworten in den Sendepuffer ---
+    while (!replies.empty() && replies.front().due_us <= now) {
+      outBuf += replies.front().bytes;
+      replies.pop_front();
+    }
+
+    // --- Ausgabe im Baudtakt ---
+    if (!outBuf.empty() && now >= nextByteUs) {
+      size_t budget = (size_t)((now - nextByteUs) / byteUs) + 1;
+      if (budget > outBuf.size()) budget = outBuf.size();
+      ssize_t w = write(master, outBuf.data(), budget);
+      if (w > 0) {
+        outBuf.erase(0, (size_t)w);
+        stats.bytes_out += (uint64_t)w;
+        nextByteUs = (nextByteUs < now ? now : nextByteUs) + (uint64_t)w * byteUs;
+      }
+    }
+
+    pollfd p = { master, POLLIN, 0 };
+    int timeoutMs = (outBuf.empty() && replies.empty()) ? 5 : 0;
+    if (poll(&p, 1, timeoutMs) < 0 && errno != EINTR) break;
+    if (timeoutMs == 0) usleep(200);
+  }
+
+  fprintf(stderr,
+          "[sim] frames=%llu replies=%llu dropped=%llu garbage=%llu ignored_off=%llu bytes_out=%llu\n",
+          (unsigned long long)stats.frames, (unsigned long long)stats.replies,
+          (unsigned long long)stats.dropped, (unsigned long long)stats.garbage,
+          (unsigned long long)stats.ignored_off, (unsigned long long)stats.bytes_out);
+
+  if (opt.link) unlink(opt.link);
+  close(keepSlave);
+  close(master);
+  return 0;
+}
@@ -2,6 +2,10 @@
 #include "ui.h"
 #include "display.h"
 #include "radio_link.h"
+#include "app_state.h"
+#include "app_events.h"
+#include "latency_trace.h"
+#include "encoder_config.h"
 
 // -------------------- Konfiguration --------------------
 // static constexpr uint32_t FREQ_MIN_HZ =     1500UL; //  1,5 kHz
@@ -56,10 +60,9 @@ static TuneCursor tuneCursor = TuneCursor::KHZ; // default im Tune-Mode
 
 static UiState st = UiState::MainMenu;
 
-// "Model" (Dummy Daten)
-static uint32_t freqHz = 14074000UL;
-static bool connected = false;
-static RadioMode activeMode = global_radio_state.mode; // RadioMode::CW; // default
+// Frequenz, Mode und Verbindung stehen in app_state()
+static bool freqDirty = false;    // AppState::freq_hz noch nicht beim Radio (gedrosselt oder Queue voll)
+static uint32_t lastFreqSendMs = 0;
 
 // -------------------- Helper --------------------
 static void setFooterMain() {
@@ -120,54 +123,107 @@ static void menuMove(int8_t steps) {
   displaySetMenuIndex((uint8_t)idx);
 }
 
-// Dummy Action: Connection toggeln
-static void actionToggleConn() {  
-  Serial.print("[ACTION] Conn -> ");
-  if (global_radio_state.radio_connected){
-    radio_send_disconnect();
-  } else
-  {
-    radio_send_connect();
+// -------------------- Aktionen --------------------
+// Aktionen warten nicht auf das Radio: senden, als offen merken, zurück.
+// Abgeschlossen werden sie von UiEvents (ACK -> neuer Zustand, kein ACK ->
+// radio_link setzt nach RADIO_ACK_TIMEOUT_MS zurück). Den offenen Zustand
+// zeigt der OLED-Header direkt aus AppState ("[USB..]", "[connecting]").
+enum class PendingAction : uint8_t { None, Conn, Mode };
+
+static PendingAction pending = PendingAction::None;
+static bool pendingConnect = false;          // Conn: Ziel
+static RadioMode pendingMode = RadioMode::UNKNOWN;
+static uint32_t pendingSinceMs = 0;
+
+static void startPending(PendingAction a) {
+  pending = a;
+  pendingSinceMs = millis();
+}
+
+static void finishPending(bool ok, const String& what) {
+  Serial.print("[ACTION] ");
+  Serial.print(pending == PendingAction::Conn ? "Conn -> " : "Mode -> ");
+  Serial.print(what);
+  Serial.print(ok ? " ok (" : " failed (");
+  Serial.print(millis() - pendingSinceMs);
+  Serial.println(" ms)");
+  pending = PendingAction::None;
+}
+
+void UiEvents::on(const LinkStateChanged& e) {
+  if (pending != PendingAction::Conn) return;
+  if (e.connected == pendingConnect) {
+    finishPending(true, e.connected ? "connected" : "disconnected");
+  } else if (e.link != RadioState::WAIT_CONNECT_ACK && e.link != RadioState::WAIT_DISCONNECT_ACK) {
+    finishPending(false, pendingConnect ? "connect" : "disconnect");
   }
-  delay(2000);
-  // displaySetConnected(global_radio_state.radio_connected);
-  Serial.println(global_radio_state.radio_connected ? "connected" : "disconnected");
 }
 
-// Dummy Action: Mode setzen
+void UiEvents::on(const ModeChanged& e) {
+  if (pending != PendingAction::Mode) return;
+  if (e.mode == pendingMode) {
+    finishPending(true, radio_mode_to_string(e.mode));
+  } else if (e.desired != pendingMode) {
+    // Timeout/Verlust (desired zurückgesetzt) oder von woanders überholt
+    finishPending(false, radio_mode_to_string(pendingMode));
+  }
+}
+
+// Connection toggeln
+static void actionToggleConn() {
+  bool connect = !app_state().connected;
+  RadioAdmit a = connect ? radio_send_connect() : radio_send_disconnect();
+  Serial.print("[ACTION] Conn -> ");
+  Serial.print(connect ? "connect " : "disconnect ");
+  Serial.println(radio_admit_to_string(a));
+  if (!radio_admit_ok(a) || app_state().connected == connect) return;   // abgelehnt oder sofort erledigt
+  pendingConnect = connect;
+  startPending(PendingAction::Conn);
+}
+
+// Mode setzen
 static void actionSetModeFromIndex(uint8_t idx) {
-  // RadioMode newMode = RadioMode::UNKNOWN;
+  // desired_mode setzt radio_send_mode()
   const char* name = "----";
   switch (idx) {
-    case 0: global_radio_state.desired_mode = RadioMode::CW;  name = "CW";  break;
-    case 1: global_radio_state.desired_mode = RadioMode::USB; name = "USB"; break;
-    case 2: global_radio_state.desired_mode = RadioMode::LSB; name = "LSB"; break;
-    case 3: global_radio_state.desired_mode = RadioMode::AM;  name = "AM";  break;
-    case 4: global_radio_state.desired_mode = RadioMode::FM;  name = "FM";  break;
+    case 0: name = "CW";  break;
+    case 1: name = "USB"; break;
+    case 2: name = "LSB"; break;
+    case 3: name = "AM";  break;
+    case 4: name = "FM";  break;
     default: break;
   }
-  radio_send_mode(name);
+  RadioMode before = app_state().mode;
+  RadioAdmit a = radio_send_mode(name);
   Serial.print("[ACTION] Mode -> ");
-  Serial.println(name);
+  Serial.print(name);
+  Serial.print(" ");
+  Serial.println(radio_admit_to_string(a));
+  if (!radio_admit_ok(a) || app_state().mode != before) return;        // abgelehnt oder ohne ACK schon gesetzt
+  if (app_state().desired_mode == before) return;                       // war schon dieser Mode
+  pendingMode = app_state().desired_mode;
+  startPending(PendingAction::Mode);
 }
 
 // Dummy Action: Preset anwenden (hier: Frequenz setzen)
 static void actionApplyPresetFromIndex(uint8_t idx) {
   // Beispielwerte – anpassen wie du willst
+  uint32_t hz = app_state().freq_hz;
   switch (idx) {
-    case 0: freqHz = 7030000UL;   break; // P1
-    case 1: freqHz = 14074000UL;  break; // P2
-    case 2: freqHz = 28400000UL;  break; // P3
-    case 3: freqHz = 10100000UL;  break; // P4
+    case 0: hz = 7030000UL;   break; // P1
+    case 1: hz = 14074000UL;  break; // P2
+    case 2: hz = 28400000UL;  break; // P3
+    case 3: hz = 10100000UL;  break; // P4
     default: break;
   }
 
-  displaySetFrequencyHz(freqHz);
+  app_state_set_freq(hz);
+  freqDirty = true;   // senden wie beim Tunen: flushPendingFreq()
 
   Serial.print("[ACTION] Preset -> P");
   Serial.print(idx + 1);
   Serial.print(" (Freq=");
-  Serial.print(freqHz);
+  Serial.print(hz);
   Serial.println(" Hz)");
 }
 
@@ -211,35 +267,50 @@ static void tuneCursorMove(int8_t steps) {
   Serial.println(stepHzFromIdx(tune_step_idx));
 }
 
-static void tuneBySteps(int8_t steps) {
-  if (steps == 0) return;
+// accelSteps sind bereits beschleunigt (EncoderEvent::accelSteps); der
+// Faktor wird hier je Cursor auf ENC_ACCEL_MAX_STEP_HZ pro Rastung begrenzt
+static void tuneBySteps(int8_t detents, int32_t accelSteps) {
+  if (accelSteps == 0) return;
 
   uint32_t step = stepHzFromIdx(tune_step_idx);
-  int64_t f = (int64_t)freqHz + (int64_t)steps * (int64_t)step;
+  int32_t maxFactor = (int32_t)(ENC_ACCEL_MAX_STEP_HZ / step);
+  if (maxFactor < 1) maxFactor = 1;
+  int32_t n = detents < 0 ? -detents : detents;
+  if (n == 0) n = 1;   // hin und zurück in einem Event
+  int32_t steps = constrain(accelSteps, -n * maxFactor, n * maxFactor);
+
+  int64_t f = (int64_t)app_state().freq_hz + (int64_t)steps * (int64_t)step;
 
   if (f < (int64_t)FREQ_MIN_HZ) f = FREQ_MIN_HZ;
   if (f > (int64_t)FREQ_MAX_HZ) f = FREQ_MAX_HZ;
 
-  freqHz = (uint32_t)f;
-  displaySetFrequencyHz(freqHz);
+  app_state_set_freq((uint32_t)f);
 
   Serial.print("[TUNE] step=");
   Serial.print(step);
-  Serial.print(" Hz  Freq=");
-  Serial.println(freqHz);
-  // todo: radio_send_freq verzögern, damit radio nicht überfahren wird.
-  radio_send_freq(freqHz);
-  
+  Serial.print(" Hz x");
+  Serial.print(steps);
+  Serial.print("  Freq=");
+  Serial.println((uint32_t)f);
+  // Senden übernimmt flushPendingFreq(), gedrosselt auf ENC_FREQ_SEND_MIN_MS
+  freqDirty = true;
+}
+
+// Schnelles Drehen erzeugt so nur ein Radio-Update pro Intervall mit dem
+// jeweils letzten Wert; der Endwert geht immer raus (auch nach Queue voll).
+static void flushPendingFreq() {
+  if (!freqDirty || radio_queue_busy()) return;
+  uint32_t now = millis();
+  if (now - lastFreqSendMs < ENC_FREQ_SEND_MIN_MS) return;
+  lastFreqSendMs = now;
+  freqDirty = radio_send_freq(app_state().freq_hz) == RadioAdmit::QUEUE_FULL;
 }
 
 // -------------------- Public API --------------------
 void ui_init() {
-  // Initiale Anzeige
+  // Initiale Anzeige (Header und Frequenz kommen aus app_state())
   setFooterMain();
   displaySetMenuIndex(0);
-  displaySetConnected(connected);
-  displaySetMode(activeMode);
-  displaySetFrequencyHz(freqHz);
   displaySetTuneMarker(false);
 
   Serial.println("[UI] init");
@@ -247,6 +318,19 @@ void ui_init() {
 }
 
 void ui_handleEncoder(const EncoderEvent& ev) {
+  // Latenz: Wartezeit seit der ISR; neue Wunschfrequenzen in diesem Aufruf
+  // tragen den ISR-Zeitstempel weiter
+  if (ev.t_us) {
+    latency_record(LatencyOrigin::Encoder, LatencyStage::IsrToPoll, micros() - ev.t_us);
+    latency_input_begin(LatencyOrigin::Encoder, ev.t_us);
+  }
+
+  if (ev.steps != 0 || ev.button != EncButtonEvent::None) {
+    AppBus::publish(InputEvent{ ev.steps, ev.accelSteps, ev.velocity, ev.button,
+                                (uint8_t)(radio_queue_depth() * 100 / radio_queue_capacity()),
+                                (uint32_t)millis() });
+  }
+
   // 1) Drehbewegung
   if (ev.steps != 0) {
     switch (st) {
@@ -275,14 +359,12 @@ void ui_handleEncoder(const EncoderEvent& ev) {
           tune_step_idx = (uint8_t)i;
           displaySetTuneCursor(tune_step_idx);
         } else {
-          // Tunen
-          uint32_t step = stepHzFromIdx(tune_step_idx);
-          tuneBySteps(ev.steps);
+          // Tunen (beschleunigt nach Drehgeschwindigkeit)
+          tuneBySteps(ev.steps, ev.accelSteps);
         }
         break;
     }
   }
-
   // 2) Button Events
   if (ev.button == EncButtonEvent::Click) {
     switch (st) {
@@ -343,4 +425,7 @@ void ui_handleEncoder(const EncoderEvent& ev) {
         break;
     }
   }
+  // Tunen und Preset-Auswahl: neue Wunschfrequenz gedrosselt ans Radio
+  flushPendingFreq();
+  latency_input_end();
 }
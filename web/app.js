@@ -0,0 +1,479 @@
+// Hauptseite: Bedienung, Live-Status, Telemetrie, OLED-Spiegel
+
+(function enableWheelSwipe(){
+  const el = document.getElementById('freqDisplay');
+  if(!el) return;
+
+  let sx=0, sy=0;
+  let lastAction = 0;
+  const TH = 25;      // Pixel-Schwelle
+  const RATE = 80;    // ms zwischen Aktionen
+
+  el.style.touchAction = "none"; // wichtig, damit der Browser nicht scrollt/zoomt
+
+  el.addEventListener('touchstart', (e)=>{
+    const t = e.touches[0];
+    sx = t.clientX; sy = t.clientY;
+  }, {passive:true});
+
+  el.addEventListener('touchend', async ()=>{
+    await flushFreq();
+  }, {passive:true});
+
+  el.addEventListener('touchcancel', async ()=>{
+    await flushFreq();
+  }, {passive:true});
+
+
+  el.addEventListener('touchmove', async (e)=>{
+    const t = e.touches[0];
+    const dx = t.clientX - sx;
+    const dy = t.clientY - sy;
+
+    const now = Date.now();
+    if(now - lastAction < RATE) return;
+
+    if(Math.abs(dy) > Math.abs(dx) && Math.abs(dy) > TH){
+      lastAction = now;
+      sy = t.clientY; // reset, damit man weiterwischen kann
+      if(dy < 0) await freqPlus(); else await freqMinus();
+    }
+    else if(Math.abs(dx) > Math.abs(dy) && Math.abs(dx) > TH){
+      lastAction = now;
+      sx = t.clientX;
+      if(dx > 0) stepRight(); else stepLeft();
+    }
+  }, {passive:true});
+})();
+
+
+//------------------------------------------------------------
+
+function logLine(s){
+  const el=document.getElementById('log');
+  el.textContent += s + "\n"; // "\\n"
+  el.scrollTop = el.scrollHeight;
+}
+
+window.addEventListener('error', (e) => {
+  logLine("JS ERROR: " + (e.message || e));
+});
+
+window.addEventListener('unhandledrejection', (e) => {
+  logLine("PROMISE ERROR: " + (e.reason?.message || e.reason || e));
+});
+
+
+function setConn(connected, lost){
+  document.getElementById('led').style.background = connected ? '#0a0' : (lost ? '#e80' : '#c00');
+  document.getElementById('connText').textContent = connected ? 'Connected' : (lost ? 'Radio lost' : 'Disconnected');
+
+  const b = document.getElementById('connBtn');
+  if(b){
+    b.textContent = connected ? "Disconnect" : "Connect";
+    b.classList.toggle('primary', !connected); // primary nur bei "Connect"
+  }
+}
+
+// Radio-Queue voll (429) bzw. laut /api/state noch nicht wieder frei
+function setBusy(busy, depth, capacity){
+  const p = document.getElementById('busyPill');
+  if(!p) return;
+  p.style.display = busy ? '' : 'none';
+  if(busy && depth !== undefined){
+    document.getElementById('busyText').textContent = capacity ? `Busy ${depth}/${capacity}` : `Busy ${depth}`;
+  }
+}
+
+async function toggleConnect(){
+  const isConnected = document.getElementById('connText').textContent === 'Connected';
+  await sendCmd(isConnected ? 'disconnect' : 'connect');
+}
+
+
+function markPreset(p){
+  const ids = ["Plain","1","2","3","4","5","6","7","8","9"];
+  ids.forEach(x=>{
+    const id = (x==="Plain") ? "pPlain" : ("p"+x);
+    const el = document.getElementById(id);
+    if(el) el.classList.toggle('active', x===p);
+  });
+}
+
+// Stand aus /api/state bzw. WebSocket-Push (Deltas werden in liveState gemischt)
+const liveState = {};
+
+function applyState(st){
+  setConn(!!st.radio_connected, !!st.link_lost);
+  setBusy(!!st.queue_busy, st.queue_depth);
+
+  if(pendingFreqHz === null) {
+    currentFreqHz = parseInt(st.freq_hz, 10) || currentFreqHz;
+    updateFreqUI();
+    lastSentFreqHz = currentFreqHz; // optional, verhindert direktes Resend
+  }
+  // Wunsch noch nicht vom Radio bestätigt: gedimmt, Radiowert als Tooltip
+  const fd = document.getElementById('freqDisplay');
+  if(fd){
+    const unconfirmed = st.freq_confirmed === false;
+    fd.style.opacity = unconfirmed ? '0.55' : '';
+    fd.title = unconfirmed && st.freq_radio_hz ? `Radio: ${fmtHz(st.freq_radio_hz)}` : '';
+  }
+
+  ['LSB','USB','CW','AM'].forEach(x=>{
+    document.getElementById('m'+x).classList.toggle('active', st.mode===x);
+  });
+
+  markPreset(st.preset || "Platin");
+
+  document.getElementById('netInfo').textContent =
+    `WiFi: ${st.wifi_mode} | STA: ${st.sta_ip || '-'} | AP: ${st.ap_ip || '-'}` +
+    (st.link_losses ? ` | Link-Verluste: ${st.link_losses} (erkannt ${st.link_detect_ms} ms, wieder da ${st.link_reconnect_ms} ms)` : '');
+}
+
+async function refreshState(){
+  try{
+    const r = await fetch('/api/state');
+    applyState(Object.assign(liveState, await r.json()));
+  }catch(e){
+    // ignore
+  }
+}
+
+// ------- Live-Status per WebSocket (/ws); ohne Verbindung Polling wie bisher -------
+const WS_RETRY_MS = 3000;
+const WS_CMD_TIMEOUT_MS = 2000;
+let ws = null, wsLive = false, wsNextId = 1;
+const wsPending = {};   // id -> resolve
+
+function connectWs(){
+  try{
+    ws = new WebSocket(`ws://${location.host}/ws`);
+  }catch(e){
+    setTimeout(connectWs, WS_RETRY_MS);
+    return;
+  }
+  ws.onopen = () => { wsLive = true; logLine("WS live"); };
+  ws.onclose = () => {
+    if(wsLive) logLine("WS closed, polling");
+    wsLive = false;
+    ws = null;
+    Object.keys(wsPending).forEach(id => wsPending[id](null));
+    setTimeout(connectWs, WS_RETRY_MS);
+  };
+  ws.onmessage = (e) => {
+    let m;
+    try{ m = JSON.parse(e.data); }catch(x){ return; }
+    if(m.type === 'state'){
+      delete m.type;
+      applyState(Object.assign(liveState, m));
+    } else if(m.type === 'cmd' && wsPending[m.id]){
+      wsPending[m.id](m);
+    }
+  };
+}
+
+// Antwort {status, ok, result, depth, capacity, retry_ms} oder null (Timeout/getrennt)
+function wsCmd(msg){
+  return new Promise(resolve => {
+    const id = wsNextId++;
+    const t = setTimeout(() => done(null), WS_CMD_TIMEOUT_MS);
+    function done(m){ clearTimeout(t); delete wsPending[id]; resolve(m); }
+    wsPending[id] = done;
+    ws.send(JSON.stringify({...msg, id}));
+  });
+}
+
+// Liefert {ok, status, retryMs}: 400 = ungültig, 429 = Radio-Queue voll,
+// 503 = Radio nicht bereit. Per HTTP heißt ok "geprüft und angenommen" (202),
+// das Ergebnis zeigt /api/state.
+async function sendCmd(cmd, payload={}){
+  const btn = document.getElementById('connBtn');
+  if(btn) btn.disabled = true;
+
+  const body = JSON.stringify({cmd, ...payload});
+  logLine("" + body);
+
+  let res = {ok:false, status:0, retryMs:1000};
+  const viaWs = wsLive;
+  try{
+    if(viaWs){
+      // neuer Stand kommt per Push, kein Nachladen nötig
+      const m = await wsCmd({cmd, ...payload});
+      if(!m) throw new Error("timeout");
+      logLine("ws " + m.status + " " + m.result);
+      res = {ok:m.ok, status:m.status, retryMs: m.retry_ms || 1000};
+      setBusy(m.status === 429, m.depth, m.capacity);
+    } else {
+      const r = await fetch('/api/cmd', {method:'POST', headers:{'Content-Type':'application/json'}, body});
+      const t = await r.text();
+      logLine(r.status + " " + t);
+      let j = {};
+      try{ j = JSON.parse(t); }catch(e){}
+      const ra = parseInt(r.headers.get('Retry-After'), 10);
+      res = {ok:r.ok, status:r.status, retryMs: j.retry_ms || (ra > 0 ? ra * 1000 : 1000)};
+      setBusy(r.status === 429, j.depth, j.capacity);
+    }
+  } catch(e){
+    logLine("ERROR: no response");
+  } finally {
+    if(!viaWs) await refreshState();
+    if(btn) btn.disabled = false;
+  }
+  return res;
+}
+
+function setPreset(p){
+  sendCmd('preset', {value:p});
+}
+
+function setMode(m){
+  sendCmd('mode', {value:m});
+}
+
+
+// ------- Frequency "front panel" control -------
+const FREQ_MIN = 100000;   // RX: 100 kHz TX: 1,5 MHz
+const FREQ_MAX = 30000000;  // 30 MHz
+
+let currentFreqHz = 6075000;
+
+const FREQ_DEBOUNCE_MS = 500;
+const FREQ_BACKOFF_MAX_MS = 4000;
+let freqDelayMs = FREQ_DEBOUNCE_MS;   // wächst bei 429, schrumpft bei Erfolg
+
+let freqSendTimer = null;
+let pendingFreqHz = null;
+let lastSentFreqHz = null;
+
+
+// 1 Hz .. 10 MHz
+const STEPS = [1,10,100,1000,10000,100000,1000000,10000000];
+let stepIndex = 3; // 1 kHz
+
+function clamp(v, lo, hi){ return Math.max(lo, Math.min(hi, v)); }
+
+function fmtHz(n){
+  const s = String(Math.trunc(n));
+  return s.replace(/\B(?=(\d{3})+(?!\d))/g, " ") + " Hz";
+}
+
+// genau EINE Stelle unterstreichen (aktive Digit-Position)
+function fmtHzWithUnderline(freq, step){
+  const raw = String(Math.trunc(freq)).padStart(8, '0'); // bis 30 MHz: 8 Stellen
+  const len = raw.length;
+
+  const posFromRight = Math.log10(step) | 0;      // 1->0, 10->1, ...
+  const activeIndex  = len - 1 - posFromRight;    // Index im String
+
+  let out = "";
+  for(let i=0;i<len;i++){
+    const ch = raw[i];
+    out += (i === activeIndex) ? `<u>${ch}</u>` : ch;
+
+    const fromRight = len - i - 1;
+    if(fromRight % 3 === 0 && i !== len - 1) out += " ";
+  }
+  return out + " Hz";
+}
+
+function updateFreqUI(){
+  const fd = document.getElementById('freqDisplay');
+  if(fd) fd.innerHTML = fmtHzWithUnderline(currentFreqHz, STEPS[stepIndex]);
+
+  const sl = document.getElementById('stepLabel');
+  if(sl) sl.textContent = fmtHz(STEPS[stepIndex]);
+}
+
+function scheduleFreqSend(){
+  // Timer neu starten
+  if(freqSendTimer) clearTimeout(freqSendTimer);
+
+  pendingFreqHz = currentFreqHz;
+
+  freqSendTimer = setTimeout(async () => {
+    freqSendTimer = null;
+
+    // nichts zu tun?
+    if(pendingFreqHz === null) return;
+
+    // nicht doppelt senden
+    if(lastSentFreqHz === pendingFreqHz) return;
+
+    const toSend = pendingFreqHz;
+    pendingFreqHz = null;
+
+    // Send (robust)
+    await sendFreq(toSend);
+  }, freqDelayMs);
+}
+
+// Bei vollem Radio (429) nicht verwerfen: Abstand verdoppeln und nach
+// Retry-After erneut versuchen – außer der Nutzer hat inzwischen weitergedreht.
+async function sendFreq(hz){
+  const res = await sendCmd('freq', { hz });
+  if(res.ok){
+    lastSentFreqHz = hz;
+    freqDelayMs = Math.max(FREQ_DEBOUNCE_MS, freqDelayMs / 2);
+    return;
+  }
+  if(res.status === 429){
+    freqDelayMs = Math.min(FREQ_BACKOFF_MAX_MS, Math.max(freqDelayMs * 2, res.retryMs));
+    if(pendingFreqHz === null) pendingFreqHz = hz;
+    if(freqSendTimer) clearTimeout(freqSendTimer);
+    freqSendTimer = setTimeout(() => { freqSendTimer = null; flushFreq(); }, Math.max(res.retryMs, freqDelayMs));
+  }
+}
+
+async function flushFreq(){
+  if(freqSendTimer){
+    clearTimeout(freqSendTimer);
+    freqSendTimer = null;
+  }
+  if(pendingFreqHz === null) return;
+  if(lastSentFreqHz === pendingFreqHz) { pendingFreqHz = null; return; }
+
+  const toSend = pendingFreqHz;
+  pendingFreqHz = null;
+
+  await sendFreq(toSend);
+}
+
+function pushFreq(){
+  currentFreqHz = clamp(currentFreqHz, FREQ_MIN, FREQ_MAX);
+  updateFreqUI();
+  scheduleFreqSend();
+}
+
+function freqPlus(){
+  currentFreqHz = clamp(currentFreqHz + STEPS[stepIndex], FREQ_MIN, FREQ_MAX);
+  pushFreq();
+}
+
+async function freqMinus(){
+  currentFreqHz = clamp(currentFreqHz - STEPS[stepIndex], FREQ_MIN, FREQ_MAX);
+  await pushFreq();
+}
+
+function stepLeft(){
+  // gröber
+  stepIndex = clamp(stepIndex + 1, 0, STEPS.length - 1);
+  updateFreqUI();
+}
+
+function stepRight(){
+  // feiner
+  stepIndex = clamp(stepIndex - 1, 0, STEPS.length - 1);
+  updateFreqUI();
+}
+
+// ------- Telemetrie (inkrementell per Cursor) -------
+const TELEM_CH = ['smeter','txpower','swr'];
+const TELEM_KEEP = 120;            // Punkte pro Kanal im Browser
+const telem = {};
+TELEM_CH.forEach(c => telem[c] = {cursor:0, v:[]});
+
+async function refreshTelemetry(){
+  for(const ch of TELEM_CH){
+    const t = telem[ch];
+    try{
+      const r = await fetch(`/api/telemetry?ch=${ch}&cursor=${t.cursor}`);
+      if(!r.ok) continue;
+      const d = await r.json();
+      if(d.cursor !== t.cursor) t.v = [];   // Lücke -> neu aufbauen
+      t.v = t.v.concat(d.v).slice(-TELEM_KEEP);
+      t.cursor = d.next;
+    }catch(e){
+      // ignore
+    }
+  }
+  drawTelemetry();
+}
+
+function lastOf(ch){
+  const v = telem[ch].v;
+  return v.length ? v[v.length - 1] : '-';
+}
+
+function drawTelemetry(){
+  const cv = document.getElementById('telemCanvas');
+  if(!cv) return;
+  const g = cv.getContext('2d');
+  const v = telem.smeter.v;
+  g.clearRect(0, 0, cv.width, cv.height);
+  if(v.length > 1){
+    const lo = Math.min(...v), hi = Math.max(...v);
+    const span = Math.max(1, hi - lo);
+    g.strokeStyle = getComputedStyle(document.body).color;
+    g.beginPath();
+    v.forEach((y, i) => {
+      const px = i * cv.width / (TELEM_KEEP - 1);
+      const py = cv.height - 2 - (y - lo) * (cv.height - 4) / span;
+      if(i) g.lineTo(px, py); else g.moveTo(px, py);
+    });
+    g.stroke();
+  }
+  const swr = lastOf('swr');
+  document.getElementById('telemInfo').textContent =
+    `S: ${lastOf('smeter')} | PWR: ${lastOf('txpower')} | SWR: ${swr === '-' ? '-' : (swr / 100).toFixed(2)}`;
+}
+
+// ------- OLED-Spiegel (XOR/RLE-Deltas per Frame-Version) -------
+const FB_W = 128, FB_H = 128, FB_BYTES = FB_W * FB_H / 8;
+const FB_POLL_MS = 300;            // nach einer Änderung
+const FB_IDLE_MS = 1000;           // solange nichts kommt
+const fb = {buf: new Uint8Array(FB_BYTES), v: 0};
+
+// Tokens: <0x80 -> n+1 Bytes überspringen, >=0x80 -> n-0x7F Bytes XOR
+function applyFb(data, keyframe){
+  if(keyframe) fb.buf.fill(0);
+  let i = 0, p = 0;
+  while(p < data.length && i < FB_BYTES){
+    const t = data[p++];
+    if(t < 0x80){ i += t + 1; continue; }
+    for(let n = t - 0x7F; n > 0; n--) fb.buf[i++] ^= data[p++];
+  }
+}
+
+function drawFb(){
+  const cv = document.getElementById('fbCanvas');
+  if(!cv) return;
+  const g = cv.getContext('2d');
+  const img = g.createImageData(FB_W, FB_H);
+  for(let y = 0; y < FB_H; y++){
+    for(let x = 0; x < FB_W; x++){
+      const px = y, py = FB_H - 1 - x;   // Rotation 3 wie am Gerät
+      const c = (fb.buf[px + (py >> 3) * FB_W] >> (py & 7)) & 1 ? 255 : 0;
+      const o = (y * FB_W + x) * 4;
+      img.data[o] = img.data[o + 1] = img.data[o + 2] = c;
+      img.data[o + 3] = 255;
+    }
+  }
+  g.putImageData(img, 0, 0);
+}
+
+async function pollFb(){
+  let wait = FB_IDLE_MS;
+  if(!document.hidden){
+    try{
+      const r = await fetch(`/api/fb?v=${fb.v}`, {cache:'no-store'});
+      if(r.status === 200){
+        applyFb(new Uint8Array(await r.arrayBuffer()), r.headers.get('X-Fb-Keyframe') === '1');
+        drawFb();
+        wait = FB_POLL_MS;
+      }
+      if(r.ok) fb.v = parseInt(r.headers.get('X-Fb-Version') || '0', 10);
+    }catch(e){
+      // ignore
+    }
+  }
+  setTimeout(pollFb, wait);
+}
+
+updateFreqUI();
+refreshState();
+connectWs();
+setInterval(() => { if(!wsLive) refreshState(); }, 1500);
+refreshTelemetry();
+setInterval(refreshTelemetry, 2000);
+pollFb();
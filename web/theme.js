@@ -0,0 +1,20 @@
+// Dark Mode, gemeinsam für alle Seiten (Einstellung im localStorage)
+
+function applyDark(isDark){
+  document.body.classList.toggle('dark', isDark);
+  const b = document.getElementById('darkBtn');
+  if(b) b.textContent = isDark ? "☀️" : "🌙";
+}
+
+function toggleDark(){
+  const isDark = !document.body.classList.contains('dark');
+  applyDark(isDark);
+  try{ localStorage.setItem('dark', isDark ? "1" : "0"); }catch(e){}
+}
+
+// beim Start wiederherstellen
+(function(){
+  let isDark = false;
+  try{ isDark = localStorage.getItem('dark') === "1"; }catch(e){}
+  applyDark(isDark);
+})();
@@ -0,0 +1,558 @@
+// Erzeugt von tools/gen_web_assets.py aus web/ – nicht von Hand ändern.
+#include "web_assets.h"
+
+// app.css: 2214 -> 888 Bytes
+static const uint8_t WEB_APP_CSS[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0xdd,0x8e,0x9b,0x3a,
+  0x10,0xbe,0xcf,0x53,0x20,0xad,0x2a,0x6d,0xaa,0x25,0x35,0x24,0x9b,0x2c,0xe6,0xaa,
+  0xad,0xd4,0x73,0x2e,0x2b,0xb5,0x2f,0x60,0xf0,0x40,0xdc,0x05,0x1b,0x19,0xb3,0x49,
+  0x0e,0xda,0x37,0x3b,0x77,0x7d,0xb1,0x8e,0xcd,0x5f,0x48,0xb2,0x55,0x55,0x22,0x25,
+  0x99,0x61,0x18,0x7f,0xdf,0x37,0x3f,0x7c,0x78,0xef,0xfd,0x03,0x25,0x08,0x59,0xb3,
+  0x12,0x6a,0xef,0xfb,0x1e,0x0d,0x2f,0xfb,0xf9,0xbf,0xf6,0xfe,0x65,0x4d,0x65,0x6a,
+  0x10,0x06,0xbc,0x46,0x72,0xef,0x1b,0x98,0xa6,0xf2,0xde,0x7f,0x58,0x50,0xad,0x94,
+  0x69,0x17,0x9e,0xe7,0xfb,0x49,0x4e,0xef,0x32,0x77,0xc5,0xce,0xce,0xd0,0x0e,0xdc,
+  0xd5,0xd9,0x65,0x63,0x80,0xd3,0xbb,0xad,0xbb,0x3a,0x57,0xca,0x34,0x9f,0x1e,0xea,
+  0xb2,0x28,0xcd,0x41,0xd3,0xbb,0x34,0x4a,0x39,0xdf,0x0e,0x4e,0x23,0x31,0x6c,0x67,
+  0x3f,0xf1,0xe0,0xf8,0xd4,0x07,0x26,0x51,0x02,0x29,0x1b,0xdd,0x5f,0xb5,0x28,0x99,
+  0x3e,0xd1,0x3b,0x88,0xb2,0x70,0x80,0x32,0xf9,0xc7,0xa7,0x76,0x7c,0x33,0xdc,0x2d,
+  0x54,0xfe,0xe9,0x02,0x2b,0xba,0xbe,0xa0,0x8b,0x90,0x2c,0x23,0x24,0x5e,0xbc,0x2e,
+  0x12,0xc5,0x4f,0x2b,0xce,0xf4,0xf3,0xc4,0x95,0x64,0x18,0xfe,0x38,0x71,0x85,0x27,
+  0x60,0x19,0x99,0x71,0x8d,0x18,0x5b,0x27,0xe1,0x39,0xd7,0x60,0x13,0x44,0xe1,0x3a,
+  0x9e,0x51,0x0d,0xd9,0x3a,0xdc,0x84,0xf1,0xc4,0x34,0x60,0x61,0xb8,0x26,0x57,0x4c,
+  0x2f,0xe2,0x46,0xa6,0x41,0x12,0xb2,0xcd,0xe6,0x2d,0xa6,0xeb,0xcd,0x23,0xd9,0xb1,
+  0x19,0x53,0x92,0x10,0x7e,0xc1,0x74,0xf7,0xf9,0xcb,0xe7,0x8e,0xa9,0xa3,0xda,0x66,
+  0x4a,0x1a,0x3f,0x63,0xa5,0x28,0x4e,0xb4,0x3e,0xd5,0x06,0x4a,0xbf,0x11,0x0f,0x1f,
+  0xb5,0x60,0x45,0x8c,0xd9,0x73,0x21,0x69,0xb0,0xad,0x8e,0xf8,0xff,0xe8,0x1f,0x04,
+  0x37,0x7b,0xba,0xdb,0x12,0xb4,0x13,0x96,0x3e,0xe7,0x5a,0x61,0x8f,0xd0,0x17,0xa6,
+  0xef,0xad,0x52,0xcb,0x38,0x55,0x85,0xd2,0xbd,0x9d,0xe5,0xcb,0xd7,0xc5,0x4a,0xab,
+  0x43,0xcb,0x45,0x5d,0x15,0xec,0x44,0xb3,0x02,0x8e,0x71,0xce,0x2a,0x1a,0x84,0x98,
+  0xc0,0x5a,0xfe,0x41,0xa3,0x69,0xbf,0x30,0xd4,0xea,0xd6,0xf6,0x52,0x05,0xd5,0xd1,
+  0xab,0x55,0x21,0xb8,0xd7,0x27,0x77,0xee,0x65,0xdc,0xfd,0xfa,0x9a,0x71,0xd1,0xd4,
+  0x5d,0x9e,0x8a,0x71,0x2e,0x64,0x3e,0x25,0xa5,0x41,0x5c,0x0a,0xd9,0x83,0x0d,0x6f,
+  0x83,0xb5,0x67,0x59,0x78,0x46,0x55,0x09,0xd3,0x73,0x84,0xac,0x10,0xb9,0xf4,0x71,
+  0x00,0xca,0x9a,0xa6,0x20,0x0d,0xe8,0xf8,0x47,0x53,0x1b,0x91,0x9d,0xfc,0x14,0xc5,
+  0x42,0x0f,0xad,0x2b,0x96,0x82,0x9f,0x80,0x39,0x00,0xc8,0x5e,0x26,0xc4,0x68,0x8c,
+  0x2a,0x1d,0x0e,0xcc,0x5c,0x89,0xa2,0x68,0x07,0x6c,0x28,0xa0,0x17,0x38,0x20,0x33,
+  0xfc,0x51,0x14,0x8d,0xbe,0xb7,0x29,0xbf,0x85,0xbd,0x00,0xde,0x76,0x24,0x5d,0xea,
+  0x3d,0x88,0x7c,0x6f,0xe8,0x8d,0x63,0x1e,0xc9,0xbb,0x78,0x60,0x28,0x64,0x21,0x24,
+  0x42,0x2f,0x54,0xfa,0x3c,0x00,0xd7,0xee,0xc1,0x27,0x07,0x1b,0xdb,0x6a,0x44,0x6d,
+  0x53,0x79,0x4e,0xd6,0x0b,0xd9,0xc9,0x6f,0x50,0x0f,0x5d,0x7c,0x03,0x38,0xde,0xc3,
+  0x16,0x69,0x74,0x8d,0x3d,0x52,0x29,0xe1,0x94,0xbd,0xee,0x18,0x8c,0x5a,0x55,0x5d,
+  0x67,0xb7,0xb7,0x52,0xf4,0x5d,0x3f,0xf6,0xc2,0x79,0x86,0xcb,0xa1,0xe8,0xf3,0x51,
+  0x96,0x1a,0xf1,0x02,0xad,0xd1,0x4c,0xd6,0x99,0xd2,0x25,0xad,0x53,0x56,0xc0,0x3d,
+  0x59,0x45,0x4f,0x18,0xb2,0x10,0xb2,0x6a,0xcc,0x8c,0xf6,0xdf,0x31,0x1e,0xaa,0x81,
+  0x7a,0xdf,0xae,0xda,0x35,0x5d,0x77,0xf4,0x4a,0x32,0x6d,0x07,0xa5,0x7b,0xfe,0x89,
+  0xbc,0x43,0x4c,0xab,0x1a,0xf2,0x79,0x5f,0xfe,0x81,0xe2,0xd7,0xa0,0xd5,0x0b,0xe8,
+  0xac,0x50,0x07,0xba,0x17,0x9c,0x63,0xaf,0x5e,0x4e,0x9d,0x3b,0xc7,0x4b,0x1a,0x6c,
+  0x5d,0xd9,0xf6,0xd3,0xd3,0x1f,0x44,0xe2,0x99,0x22,0x17,0x85,0xbb,0x5d,0xdd,0x69,
+  0xf0,0xdc,0xdc,0x5d,0xd1,0x3d,0x3f,0x6e,0xd5,0x57,0xe5,0x77,0x45,0xb6,0x4f,0xe4,
+  0x5a,0xf0,0x51,0x09,0x6b,0xc4,0xf6,0xcb,0xc7,0xf9,0x44,0x8f,0x01,0xdb,0x00,0x4d,
+  0x29,0x6b,0xaa,0xa1,0x02,0x66,0xee,0xb7,0x0f,0x41,0x86,0x5a,0xd8,0x3d,0xe3,0x5a,
+  0x1a,0x07,0x45,0xe5,0x76,0x99,0x0f,0x03,0xb2,0xb1,0xc8,0xd0,0x1e,0xa5,0x61,0x8d,
+  0x51,0xd6,0x71,0x05,0xc4,0x6d,0xd1,0xa5,0xbd,0x75,0x4e,0xc4,0x2d,0x52,0xe7,0x9d,
+  0xe9,0x63,0x13,0x5c,0xeb,0x8f,0xde,0xf3,0x0d,0xdb,0x08,0xbf,0x54,0x52,0xb9,0xfd,
+  0xf1,0x30,0xfe,0x1b,0xa3,0x6a,0xf1,0x1f,0x74,0x8b,0x0c,0x3d,0x87,0x3d,0xee,0x20,
+  0xdf,0x05,0x50,0xaf,0xd2,0xe0,0xca,0xe6,0x6e,0xe0,0x31,0x7e,0xa2,0x81,0x3d,0x53,
+  0xcf,0xfd,0xf8,0xd6,0x63,0x37,0xfa,0xca,0xbd,0x8e,0xda,0x73,0xb4,0xce,0xb3,0x8c,
+  0xe7,0xe9,0xed,0xe6,0x83,0x02,0xca,0xf6,0xac,0x63,0x7b,0x79,0x5c,0xdd,0x06,0xb5,
+  0xdd,0x9a,0xc0,0x60,0x35,0xed,0x9a,0xf0,0x71,0x3b,0x2d,0x9b,0xce,0x98,0x45,0x0f,
+  0x2f,0x0d,0xe2,0x39,0x59,0xb1,0x8c,0x39,0xf8,0x1a,0x24,0x0a,0x63,0xa5,0xaa,0xc4,
+  0x11,0x6c,0xd5,0xf8,0x45,0xb3,0x6e,0xe7,0x5b,0x1a,0x5f,0xc8,0xe4,0x75,0xf1,0x0b,
+  0x88,0x21,0x3f,0x1e,0xa6,0x08,0x00,0x00,
+};
+
+// app.js: 14206 -> 5357 Bytes
+static const uint8_t WEB_APP_JS[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x5b,0xdd,0x56,0xe3,0x48,
+  0x92,0xbe,0xe7,0x29,0xb2,0x3c,0xbd,0x2d,0xa9,0xb1,0x65,0x43,0x15,0xd3,0x35,0x76,
+  0x41,0x1d,0xa8,0x32,0x03,0xd3,0x50,0x30,0xd8,0xb5,0x54,0x1f,0x9a,0x05,0xd9,0x4a,
+  0xdb,0x2a,0xf4,0x37,0x52,0xca,0x3f,0xb8,0x7d,0xce,0x5e,0xec,0x1b,0xec,0x03,0xcc,
+  0x4d,0x3f,0xc3,0x5c,0xf5,0x1d,0x6f,0xb2,0x4f,0xb2,0x11,0xf9,0x23,0xa5,0x84,0xa1,
+  0xe9,0xed,0xad,0x53,0x06,0x4b,0x99,0x19,0x99,0x19,0xbf,0x5f,0x44,0x26,0xcd,0x26,
+  0x39,0x72,0xb2,0x98,0xa5,0xd4,0x63,0xb4,0x4d,0x0e,0xa8,0xeb,0xd1,0x30,0x0b,0xc7,
+  0x75,0x72,0xe2,0x4d,0x69,0xa3,0xc7,0x1c,0x96,0xa5,0x75,0xd2,0xa7,0x3e,0x0d,0x28,
+  0x4b,0x3c,0x5a,0x27,0x67,0x27,0xdd,0x8f,0x8d,0x5e,0xec,0xd1,0x31,0xf5,0x37,0x36,
+  0xcc,0x51,0x16,0x0e,0x99,0x17,0x85,0x84,0x86,0xce,0xc0,0xa7,0x97,0x13,0x4a,0xfd,
+  0xde,0xcc,0x8b,0xa9,0x69,0x2d,0x37,0x08,0x19,0x46,0x61,0xca,0x08,0xf5,0xc9,0x2e,
+  0x71,0xa3,0x61,0x16,0xd0,0x90,0xd9,0x63,0xca,0xba,0x48,0x2f,0x64,0x07,0x8b,0x63,
+  0xd7,0x34,0x46,0x09,0xfd,0xc7,0x47,0x2f,0x8d,0x7d,0x67,0x61,0x58,0x1d,0x18,0xe4,
+  0x8d,0xcc,0x57,0xd4,0xb7,0x48,0x42,0x59,0x96,0x84,0x9d,0x0d,0x78,0xe5,0x53,0x46,
+  0xd2,0xf9,0x6e,0xab,0x4e,0xd2,0xc5,0x6e,0xab,0x23,0xdf,0xf8,0x4e,0xca,0xf6,0xc5,
+  0xf4,0xbb,0x84,0xbf,0x15,0xf3,0xf5,0x8f,0xe0,0x79,0x7b,0xa7,0x43,0xf8,0xbf,0x66,
+  0x93,0x9c,0x7b,0x73,0xea,0x37,0x7a,0xc3,0xc9,0x8c,0xfa,0x3e,0xcd,0xfb,0x5d,0xec,
+  0xf7,0xbb,0xd0,0xf3,0x6d,0xab,0x23,0xfb,0x05,0x29,0xb9,0x9f,0x79,0xe9,0x70,0x42,
+  0x43,0xb2,0x7f,0x87,0x84,0x69,0x88,0xd3,0x53,0xdf,0x4e,0xd9,0xc2,0xa7,0x36,0x8b,
+  0xb2,0xe1,0x24,0x9f,0xb2,0x16,0x42,0x87,0x5a,0x07,0x47,0xce,0xbc,0xe1,0x84,0x79,
+  0xc0,0x38,0xd7,0x09,0x3c,0x46,0x5c,0x9a,0x90,0x83,0x24,0x9a,0xa5,0xf0,0x3b,0xc4,
+  0x26,0x92,0x0e,0x93,0xc8,0xf7,0x59,0xf3,0x3e,0x8a,0x02,0x26,0x69,0x3a,0xae,0xdb,
+  0x9d,0x02,0x1f,0x4e,0xbc,0x94,0xd1,0x90,0x26,0xa6,0xc1,0xe9,0xa7,0xcc,0x49,0x98,
+  0x51,0x27,0x26,0xb5,0x76,0xf7,0x90,0x8b,0x6a,0xbd,0x0c,0xe6,0x94,0x6b,0xa0,0xe9,
+  0x55,0xeb,0xba,0xc3,0xdb,0xd2,0x39,0xbc,0x66,0xf6,0xd0,0x07,0xd9,0xb1,0x2f,0x1d,
+  0xe0,0x90,0xf6,0xfc,0x23,0xf6,0x59,0xd5,0xc9,0x32,0x76,0xd2,0x14,0x64,0xda,0x66,
+  0x49,0x46,0x57,0x56,0xe7,0xf9,0x15,0xd0,0xd0,0x85,0xf9,0x9d,0x74,0x11,0x0e,0x89,
+  0x99,0x2f,0xc2,0x99,0x39,0xb0,0xb5,0x91,0x9f,0xa5,0x93,0x43,0x90,0x99,0x69,0xfd,
+  0x9f,0x68,0x0f,0x9d,0x70,0x48,0xfd,0x3f,0x44,0xfe,0x59,0xfa,0x41,0x34,0xa5,0x05,
+  0xf5,0x97,0xb1,0x50,0xb4,0xb9,0x25,0x46,0x92,0x06,0x70,0xb6,0xd4,0x5c,0xe2,0x2b,
+  0x36,0x2f,0xf8,0x56,0x55,0x7b,0x18,0xcd,0xa0,0xc3,0x47,0x87,0x51,0x1b,0xbe,0x8a,
+  0xe5,0x73,0x65,0xc6,0x86,0x86,0xae,0xac,0xef,0xb8,0xe6,0x95,0x14,0x9c,0x77,0x3c,
+  0x75,0xd8,0xc4,0x76,0x06,0xa9,0xe9,0x2e,0x2c,0xb2,0x47,0x8a,0xc7,0xb9,0x45,0xbe,
+  0xfd,0x96,0x54,0x9a,0xfb,0x47,0x96,0xd8,0x19,0x29,0x1b,0x02,0x4c,0xd7,0x91,0xef,
+  0x2b,0xaa,0x80,0x8a,0x9a,0xd0,0x94,0x32,0xa5,0xa6,0x81,0x13,0x92,0x19,0xda,0x7e,
+  0xa2,0xb4,0xfe,0xce,0x09,0x43,0x39,0x18,0x16,0x04,0x5b,0x7e,0x47,0x5a,0x96,0x12,
+  0x0d,0x48,0xe5,0x1c,0xc4,0x03,0x5b,0x03,0xfe,0xa7,0x54,0x7b,0x7d,0xea,0x85,0xfc,
+  0x3d,0x1f,0xba,0xe2,0x3f,0x79,0x8f,0xd2,0xa6,0xe6,0xe5,0x4d,0x2d,0x2a,0x9b,0x9a,
+  0xbf,0x74,0x53,0x65,0x7d,0xd7,0x56,0x3b,0x07,0x02,0xb0,0x5a,0x50,0x87,0xf8,0xc2,
+  0x1b,0x4f,0x58,0xbe,0x50,0x7c,0x73,0x42,0x47,0x4c,0x5f,0xe1,0x3a,0xcd,0x5a,0x59,
+  0x26,0xd7,0xaf,0x66,0xb3,0xf1,0x07,0xfe,0x6d,0x6c,0xe4,0x5e,0xd1,0x8f,0xc6,0x27,
+  0x5e,0x48,0xcd,0xb4,0xe4,0x0d,0x77,0x9f,0xf4,0x85,0xd0,0x5f,0xf8,0x40,0xd0,0x6f,
+  0x46,0xe7,0xec,0x43,0x14,0x82,0x6e,0x33,0xb2,0xb9,0x4b,0x52,0xb2,0x49,0x6a,0x3f,
+  0x85,0xc2,0xdd,0xd4,0x7e,0x82,0x6f,0xd2,0x31,0x71,0xc7,0xd2,0x8f,0x62,0xd4,0x6c,
+  0xf5,0x78,0x44,0x71,0xff,0xb0,0xa1,0x8d,0x8d,0x99,0x17,0xba,0xd1,0x6c,0x8d,0xb5,
+  0xd0,0x24,0x89,0x12,0xe1,0x66,0xc8,0xee,0x1e,0xc1,0x05,0xaa,0xe5,0xd6,0xfe,0xd6,
+  0x23,0xdd,0x8b,0x8b,0xb3,0x8b,0x36,0xa9,0xc1,0xb4,0x26,0xb5,0x03,0x9a,0xa6,0xce,
+  0x98,0x92,0x9f,0x7f,0x26,0xd4,0xe2,0x9c,0xea,0x3c,0x43,0x3a,0x0b,0x27,0x4e,0xe8,
+  0xfa,0xd4,0x4d,0xe8,0x57,0xca,0x39,0xf1,0xc4,0x3c,0xe7,0x17,0x67,0xa7,0xc7,0xbd,
+  0x6e,0x65,0xb2,0x84,0x3a,0x69,0x14,0xbe,0x2f,0x4d,0x2a,0x5f,0x96,0x17,0x50,0x30,
+  0x1a,0x94,0x1a,0x78,0x15,0x9a,0xc0,0xe2,0x10,0x66,0xa4,0x6e,0x1d,0x26,0x49,0x19,
+  0x67,0xfb,0xd3,0xdc,0xa6,0xae,0x61,0x49,0xcf,0x3e,0x70,0x86,0x77,0xe3,0x24,0xca,
+  0x42,0x17,0xf8,0x98,0x53,0x21,0xef,0x89,0xf1,0xa7,0x96,0xd3,0x32,0x48,0x9b,0x98,
+  0x48,0x90,0xbf,0xa0,0x6f,0xf9,0x0b,0xe3,0x4f,0xc3,0x56,0x4b,0x88,0xeb,0xc9,0x29,
+  0x90,0x52,0x1f,0x04,0x09,0xf3,0xe8,0xf2,0xac,0x4c,0xf1,0x41,0x3d,0x94,0xe6,0xb9,
+  0x70,0x5c,0x2f,0xe2,0xdb,0xe0,0xb3,0x41,0x8c,0xcc,0x07,0x19,0xc2,0xcb,0x0a,0x85,
+  0x1a,0x3c,0x17,0x5d,0x71,0xc8,0x01,0x0b,0xf3,0xc8,0x3a,0x90,0xf6,0x35,0x78,0x66,
+  0x3d,0xb5,0x62,0xaa,0x1a,0xcc,0x5c,0x93,0xcb,0xab,0x75,0xe4,0xc8,0x21,0x98,0x66,
+  0x8a,0xd2,0x06,0x47,0x3a,0x1e,0xfb,0xd4,0x34,0xe2,0xc4,0x0b,0x9c,0x64,0x01,0x52,
+  0x7e,0x95,0x13,0xb2,0xb8,0xa6,0xca,0x16,0x12,0x66,0x09,0x19,0x50,0xaf,0x20,0x86,
+  0x26,0x88,0xfa,0x09,0x7d,0xf8,0x46,0x1b,0x7f,0xcf,0x68,0x46,0xc9,0x14,0xb4,0x97,
+  0x98,0x6f,0xb6,0xff,0x62,0x91,0xc1,0xfd,0xcc,0x06,0x2f,0x90,0x31,0xd2,0x74,0x62,
+  0xaf,0x09,0x61,0x91,0x51,0x70,0x04,0xc3,0x89,0x0c,0xa9,0x33,0x8f,0x62,0x9c,0x05,
+  0xff,0xe3,0x95,0x14,0xe1,0x20,0x4b,0x17,0xe6,0x00,0x7e,0x80,0x9b,0xa3,0x31,0x9b,
+  0xd4,0xc9,0xd0,0x89,0x9d,0xa1,0xc7,0x16,0x9a,0x15,0xc6,0xcf,0x31,0x0d,0x07,0x9f,
+  0x7b,0xbe,0x5f,0xe0,0x91,0xb8,0xf0,0xd6,0x84,0xc4,0x52,0x67,0x5c,0x81,0x5a,0x80,
+  0x12,0x0e,0x40,0x91,0x71,0x41,0x21,0x2a,0x30,0x14,0xbb,0xb1,0x01,0xdc,0x1c,0x5f,
+  0x08,0x79,0xb5,0xbb,0x4b,0x40,0xc3,0xe8,0x08,0x94,0xdf,0x95,0x82,0x78,0x76,0x11,
+  0xeb,0x55,0x47,0xee,0x06,0x26,0xbc,0xc5,0xbd,0x92,0x6f,0x96,0x9c,0xfc,0xaa,0xf9,
+  0xcd,0x52,0xb5,0xad,0x6e,0x61,0x25,0xe5,0xd6,0xdb,0x8e,0x62,0xb9,0x88,0x8d,0x39,
+  0xcb,0x84,0x10,0xa5,0x5c,0x74,0xdc,0xe6,0xa5,0xb9,0x62,0xfe,0x96,0x8a,0xad,0x5b,
+  0x28,0x6c,0x56,0xd3,0x6c,0x9c,0x5d,0x04,0x8c,0x14,0xe0,0xc5,0x87,0xc0,0x35,0x75,
+  0xf2,0xc0,0x3b,0x37,0x57,0x3a,0xce,0x45,0xf5,0xdd,0xe2,0x5e,0xac,0x10,0x30,0x68,
+  0xd3,0xdd,0x39,0x8f,0x62,0x66,0xac,0xaf,0xd5,0x4d,0x61,0x8d,0x57,0xb5,0x73,0xdf,
+  0xf1,0xc2,0x5a,0xbd,0xb6,0x05,0x9f,0x6d,0xf8,0xbc,0x86,0xcf,0x1b,0xf8,0xec,0xc0,
+  0xe7,0xcf,0xf0,0xf9,0x1e,0x3e,0x6f,0xe1,0xf3,0x97,0x1a,0x8f,0xfd,0x30,0xcc,0x1e,
+  0x45,0x49,0xd7,0x19,0x4e,0xcc,0x79,0x19,0x2a,0x78,0xb8,0x69,0x78,0xb9,0xbb,0x2b,
+  0x89,0x5a,0x68,0x1a,0xb1,0xf8,0x8e,0x76,0x5a,0x8b,0x6b,0x9b,0x73,0x4b,0x87,0x08,
+  0xcf,0x02,0x5d,0xcf,0x2d,0x20,0x01,0xc2,0x5b,0x70,0xd6,0x8f,0x0d,0xc9,0x81,0x4d,
+  0x72,0xfc,0x82,0xf3,0xc6,0x02,0x02,0x09,0x0e,0x80,0x9d,0x00,0x1e,0x07,0xf7,0xe4,
+  0x64,0xa9,0x6e,0x10,0xdc,0x4a,0x2e,0xe9,0xa0,0x17,0x0d,0xef,0x28,0x6b,0x9c,0x03,
+  0x7c,0x22,0xe6,0x47,0xea,0x33,0x27,0x85,0xd8,0x9e,0xb8,0x10,0xd4,0x3d,0x08,0x44,
+  0x40,0xb5,0xc7,0xfb,0x8f,0x69,0x80,0xb1,0x9e,0x59,0x1b,0x62,0xcd,0x45,0xcb,0x2e,
+  0x59,0xae,0x3a,0x1a,0xa7,0x9d,0x38,0xf6,0x17,0xbc,0xc9,0x94,0x9e,0x54,0x79,0xd9,
+  0x57,0xaf,0x60,0xc9,0x09,0x5a,0xed,0x8d,0xe6,0x70,0xf9,0x5b,0xdf,0x0b,0xef,0x6e,
+  0xb8,0xeb,0xed,0x88,0x01,0xdc,0x1a,0x79,0xd3,0x3f,0xd0,0xc0,0x6f,0x84,0x61,0xe6,
+  0x8f,0x5c,0x37,0x85,0x37,0x03,0xbe,0xc4,0xa0,0x1a,0x5e,0x38,0x46,0xfc,0x77,0x74,
+  0xcf,0x35,0x28,0xcc,0x7c,0xe0,0x95,0x94,0x4b,0x96,0x24,0xc0,0x4d,0xd5,0x4a,0x62,
+  0x27,0x49,0xe9,0x71,0xc8,0x60,0x79,0x36,0xa2,0x90,0x9b,0xc9,0x7d,0x9d,0x6c,0x01,
+  0x02,0x80,0x20,0x51,0xea,0x2b,0xf8,0x9e,0xc5,0x2e,0xec,0x05,0xdf,0x7c,0x3e,0x56,
+  0x48,0x00,0x41,0x46,0x4f,0xa7,0x59,0x1e,0x87,0x1e,0x2c,0x8a,0x91,0x1b,0x8e,0x5f,
+  0x27,0x53,0x9a,0x4c,0x20,0xe4,0xd1,0x04,0xc0,0xa0,0x97,0xd0,0x3b,0x46,0x53,0x72,
+  0x41,0x51,0x9d,0x37,0x04,0xa6,0x80,0xde,0x97,0x59,0x98,0xa2,0x87,0x2a,0xdc,0xd4,
+  0x34,0x0a,0x84,0x87,0x03,0xff,0x97,0xb2,0x87,0x5f,0x20,0x4d,0x60,0x6d,0x10,0x83,
+  0xeb,0x05,0x01,0x20,0x31,0xde,0x34,0x43,0x9a,0x8e,0x9f,0x92,0x7e,0x14,0xf9,0xcc,
+  0x8b,0x73,0xb5,0x1e,0xb9,0xbf,0x37,0x75,0x1a,0x29,0xc7,0x22,0x08,0x80,0x30,0xa3,
+  0x70,0xe4,0x25,0x01,0xb7,0x61,0xc5,0x28,0xed,0x1d,0xf0,0x78,0x04,0x33,0x53,0xc1,
+  0x8f,0x91,0x2b,0x7d,0x5b,0x24,0x7d,0xcc,0x6e,0x89,0x02,0x98,0x69,0xcb,0xde,0xd9,
+  0xe1,0x06,0x6a,0xe4,0x23,0x98,0xc7,0x7c,0x5a,0xe9,0x09,0x3e,0x4f,0x4d,0x26,0x14,
+  0x65,0x72,0x8f,0xfe,0x8a,0xef,0xb6,0x0d,0x3e,0x69,0x14,0xb0,0xa3,0x7b,0xb3,0xda,
+  0xc5,0xe2,0x7e,0x4b,0x90,0x5e,0xa1,0x4e,0x5c,0x19,0x27,0xbd,0x03,0xa3,0x6e,0x7c,
+  0xe6,0x3f,0x3f,0x5c,0xc2,0x8f,0xfd,0x53,0xe3,0xfa,0xb1,0xcd,0x3e,0xc9,0xa3,0xc0,
+  0x00,0x23,0x7d,0xce,0xd2,0xe0,0x5d,0x10,0xb9,0x14,0x18,0x31,0xcf,0xed,0x0d,0x7e,
+  0x69,0x7e,0x06,0x7a,0xc4,0xfc,0x1b,0x2a,0x16,0x3a,0x03,0x86,0xde,0x80,0xf7,0x7a,
+  0x72,0xda,0x90,0xb2,0xe3,0x70,0x14,0x55,0x7d,0x22,0x5f,0xeb,0xed,0xa5,0x77,0xe8,
+  0x21,0x13,0x80,0xf0,0xcc,0x1b,0x79,0x37,0x38,0xff,0x8a,0xfc,0x4c,0x7a,0xfd,0x7d,
+  0xf9,0x1a,0x6c,0xfb,0xc6,0x8b,0x71,0x3e,0xa3,0x61,0x60,0xd3,0xfe,0xb9,0x6c,0x71,
+  0x62,0xad,0xe1,0x96,0x6c,0x72,0x8a,0xa6,0x66,0x79,0x29,0x68,0x25,0x70,0x1a,0xc6,
+  0x00,0xc6,0xba,0x6b,0xfc,0x3b,0x4d,0x00,0xb3,0x63,0x7a,0xcf,0x87,0x6b,0xbd,0x56,
+  0x80,0xb5,0x12,0x04,0xfc,0x4c,0x6b,0x72,0x29,0x03,0x73,0xbe,0x09,0xa0,0x35,0x80,
+  0xd4,0x5f,0xc6,0x58,0xd7,0xd1,0xba,0x24,0x54,0x1a,0xbd,0xec,0x65,0x09,0x99,0x09,
+  0x37,0x55,0x89,0x2d,0x09,0x05,0xf9,0xa6,0x13,0xe1,0x45,0xb8,0x62,0xb2,0x64,0xa1,
+  0xeb,0x67,0x02,0x7a,0x23,0xf3,0x08,0xca,0x40,0xa0,0x46,0xe1,0xda,0x0c,0x69,0xa3,
+  0x9a,0x1f,0x3a,0x1b,0x20,0x9e,0xb4,0x11,0xb6,0x8f,0x43,0x33,0x77,0x5d,0x75,0x49,
+  0x22,0xb1,0xbf,0x02,0x46,0x34,0x2d,0x4b,0x08,0x72,0xe8,0x20,0x45,0x2a,0xed,0x01,
+  0x8c,0x13,0x06,0x45,0x09,0xd5,0x90,0x87,0x44,0xec,0x7a,0xb9,0x83,0xc4,0xb0,0xdf,
+  0xdc,0x9f,0x12,0xb3,0x39,0x4b,0x01,0xc9,0x44,0x93,0x90,0x12,0x60,0xe5,0x00,0xec,
+  0x3f,0x0b,0xc7,0xe4,0x1c,0x60,0x0a,0x38,0x2a,0xe4,0x0f,0x19,0x78,0xe9,0x04,0xc6,
+  0x28,0xf4,0x2f,0xf6,0x75,0xd9,0xbb,0xb9,0xe8,0xf6,0x2f,0x7e,0xbc,0x39,0xed,0xc1,
+  0x0e,0x5f,0xb7,0x5a,0xad,0x4e,0xd1,0xf2,0xe1,0xf4,0xe3,0x4d,0xff,0xf8,0xb4,0x7b,
+  0xf6,0xb9,0x2f,0xda,0xb7,0x79,0x3b,0xd6,0x34,0x66,0x18,0xc6,0xd0,0xe9,0x01,0xef,
+  0x53,0x5c,0x16,0x91,0xf6,0x89,0xcf,0x9f,0x40,0x95,0x8e,0xd1,0x8e,0xb7,0x14,0xb1,
+  0x59,0x7a,0x2e,0x5c,0xa6,0xf0,0xde,0x72,0x9b,0x2e,0x69,0xec,0x61,0xa6,0x17,0xf9,
+  0x53,0xaa,0x39,0x74,0x29,0xb6,0xcb,0xb4,0x22,0x09,0x31,0x27,0x9d,0x15,0xdb,0x36,
+  0x6f,0x67,0x69,0xbb,0x09,0x78,0xc2,0x8f,0x80,0x89,0x30,0xd6,0x9e,0x80,0x4b,0x5f,
+  0x01,0x2f,0x6e,0xd7,0xb1,0x16,0x4c,0xa3,0xef,0x05,0x34,0xca,0x98,0x99,0xcf,0x51,
+  0xd7,0x59,0x20,0x25,0x59,0x40,0x28,0xf4,0x96,0xb3,0xd4,0x8e,0xc2,0x08,0x5c,0x3e,
+  0xc6,0x59,0x91,0x1b,0x14,0x7b,0xc6,0x94,0xac,0x53,0x24,0x0a,0x97,0x3d,0x1e,0xa8,
+  0xc0,0xea,0xc8,0xaa,0xa3,0xc6,0x0e,0x41,0x8f,0x69,0x31,0x58,0x05,0x57,0x41,0xc3,
+  0x2a,0x0d,0xe6,0x5d,0x21,0x46,0xc5,0x42,0x6e,0x35,0xb9,0xa0,0x32,0x8b,0x3b,0x1a,
+  0x37,0x40,0x02,0xe2,0x51,0xaa,0xdc,0x1d,0x5d,0xa4,0x66,0xce,0x6d,0x2b,0x77,0x40,
+  0x88,0x12,0xf6,0x0a,0x31,0x5c,0x79,0xee,0xb5,0xc9,0x63,0x96,0x9c,0xe1,0x65,0xac,
+  0x29,0xf6,0xa4,0x72,0x9e,0x5d,0x3d,0x5f,0x12,0xe5,0xae,0x40,0x50,0x44,0xb1,0x91,
+  0x00,0x3a,0xfc,0xad,0x77,0xf6,0xc9,0xe6,0x31,0x10,0x72,0x26,0x08,0x6d,0x0e,0x32,
+  0x47,0x08,0x66,0x6e,0x2d,0x15,0xb3,0x65,0x3a,0x0e,0x7c,0x09,0x6c,0xb6,0x88,0xa9,
+  0xc0,0x65,0xd2,0xc0,0x54,0xae,0xed,0x52,0x98,0x80,0x12,0xd1,0x43,0xa5,0xd4,0x2f,
+  0xb1,0xbb,0x40,0xed,0x73,0x95,0x27,0xfc,0xfa,0x34,0xc3,0x00,0x52,0x1a,0x08,0x05,
+  0x05,0x7f,0x02,0x1b,0x38,0x94,0xcf,0x5b,0x79,0x6f,0x06,0x7a,0x82,0xae,0x60,0xcf,
+  0x7e,0xc8,0x66,0x11,0xc4,0xc7,0x65,0x2a,0xeb,0x91,0xd1,0x5d,0x1d,0xb5,0x3b,0xf3,
+  0xd9,0x23,0x84,0x8f,0x0d,0xc0,0x20,0xee,0x99,0x22,0xf4,0x5c,0x28,0x0b,0x62,0x4a,
+  0x11,0x34,0xc1,0x4b,0x43,0x74,0x0f,0x01,0xfc,0xe4,0x46,0x31,0x4b,0x11,0x8b,0x06,
+  0xe9,0x98,0x2f,0x4a,0x30,0x8d,0x1b,0xc3,0x79,0x12,0x01,0x52,0xa2,0xa6,0xb4,0xa3,
+  0x42,0x16,0x1a,0x3c,0x54,0x26,0xb9,0xb9,0xd9,0xa9,0x14,0x99,0x34,0xb9,0x0b,0xf5,
+  0x74,0x21,0x2b,0x10,0x9a,0x51,0x7f,0xec,0x02,0xe4,0xb6,0xf3,0x45,0xf1,0xce,0x01,
+  0x08,0x71,0xe8,0x53,0x27,0x51,0x84,0x00,0x53,0x29,0x49,0x95,0x14,0xae,0xa3,0x6c,
+  0x1d,0xf9,0x27,0xe5,0x5d,0xea,0xc0,0x31,0x44,0x98,0xeb,0xb7,0x8d,0x90,0xc5,0xe4,
+  0xea,0x93,0xb2,0x04,0xfa,0x78,0xa3,0x85,0xb9,0xb4,0x6d,0x1b,0xb8,0x50,0x87,0x8d,
+  0xad,0xac,0x0a,0xf0,0x3c,0xf1,0xe8,0x08,0x11,0xca,0x12,0x39,0xaf,0xa4,0xc0,0x19,
+  0x7d,0x9a,0xae,0xda,0xe4,0x4d,0xab,0xc5,0xa3,0xff,0xf8,0xe1,0x57,0x9f,0x17,0x41,
+  0x21,0x7d,0x83,0x17,0xd5,0xb4,0xae,0x8e,0xa4,0x76,0x5a,0xaf,0x55,0x93,0xc4,0x47,
+  0x03,0x0a,0x09,0x1c,0xb3,0xc9,0x39,0x48,0xeb,0xa8,0xdf,0x3f,0x27,0x13,0xea,0x3d,
+  0xfc,0x93,0x81,0x94,0x49,0x6d,0x4c,0xe3,0xe4,0xe1,0xd7,0x11,0xc2,0x18,0x00,0xbe,
+  0xe1,0x98,0x86,0x51,0x00,0x31,0xb6,0x46,0xcc,0xed,0xd6,0xb6,0xc5,0x09,0xba,0x80,
+  0x73,0xbb,0xc9,0x98,0x0e,0x42,0x2f,0x25,0xf7,0x14,0xc0,0x95,0x86,0x8e,0xed,0x6a,
+  0x3c,0x52,0xb9,0x07,0x28,0x26,0x38,0x03,0x67,0xe1,0x47,0x8e,0xbb,0xbb,0x5c,0x69,
+  0x89,0xc4,0x80,0x85,0xbf,0x2b,0x9f,0x66,0xa1,0x85,0x63,0x30,0x19,0xc4,0x0a,0xb8,
+  0xab,0x7c,0x97,0x96,0x9f,0x47,0xbc,0x74,0x58,0xe5,0x37,0x5f,0x02,0x30,0x5d,0xae,
+  0x62,0xc5,0x29,0xe6,0x3e,0x0b,0x4b,0x21,0x38,0xd0,0xca,0xeb,0xdf,0x20,0x63,0x74,
+  0xf2,0xd1,0x5d,0x5b,0xc6,0x03,0x21,0x88,0x76,0x2b,0x17,0x45,0x7b,0x0b,0xc2,0xc8,
+  0xaa,0xa8,0x83,0x4f,0x3d,0xe7,0x32,0xe5,0x5a,0x8a,0x5e,0xae,0xa3,0xbb,0x7c,0x58,
+  0x39,0x6f,0xcd,0x2d,0x11,0x38,0x19,0x82,0xa0,0x12,0x99,0x64,0xdc,0x01,0x9f,0x19,
+  0x0f,0x85,0x98,0x50,0xd4,0xc9,0x1d,0x85,0x24,0xe2,0x13,0x38,0x3c,0xdf,0xc1,0x8c,
+  0x22,0x7c,0xf8,0x17,0x08,0x5a,0x0e,0x15,0x93,0x05,0x79,0x20,0x17,0x16,0xb5,0x7e,
+  0x7f,0x72,0xee,0x57,0x81,0x45,0xd8,0x24,0x89,0x66,0xdc,0xd2,0xba,0x58,0x89,0x32,
+  0x6b,0x4c,0xa8,0x79,0x2d,0xef,0x98,0x33,0x03,0x5c,0x32,0xf2,0x23,0xb0,0xc5,0x96,
+  0xb1,0x12,0x26,0x5f,0x08,0x37,0x90,0x8f,0x28,0x78,0x14,0xd8,0x85,0xae,0xb6,0xd5,
+  0xc0,0x82,0x53,0x7c,0xa8,0x70,0x14,0x88,0xa5,0x72,0xc6,0x49,0x97,0xcd,0x93,0x96,
+  0x7c,0x3a,0x74,0x65,0xa0,0xd2,0xe0,0xed,0x6c,0xe9,0x6e,0x02,0x3b,0x2f,0x29,0x94,
+  0xdc,0xdf,0xb2,0xc4,0x92,0xf5,0xd8,0x06,0x7d,0x62,0x9d,0x2c,0x03,0xca,0x26,0x91,
+  0xdb,0x36,0xce,0xcf,0x7a,0x7d,0x78,0x9e,0x50,0x60,0x6c,0x92,0xb6,0x97,0x86,0xc4,
+  0x8a,0x8d,0x3e,0x78,0x51,0xa3,0x6d,0xa0,0x17,0xf6,0x44,0x10,0x6e,0x22,0xba,0x31,
+  0x56,0x75,0xae,0x18,0x05,0x3f,0x0b,0xa7,0xa3,0x50,0x10,0x42,0x4e,0xf3,0x11,0x1b,
+  0x93,0x2a,0xfb,0x0a,0xbe,0xa1,0x7e,0x7d,0x95,0x09,0xa0,0x78,0xc3,0xa3,0xcc,0xd7,
+  0x72,0x94,0x61,0x45,0x80,0x81,0xc8,0xbf,0x2a,0xef,0xd5,0xd1,0x13,0xb2,0xc4,0x96,
+  0xfb,0x41,0xfb,0x31,0x8d,0x0b,0x64,0x75,0x63,0x7f,0xc4,0x68,0x62,0x58,0x3c,0x45,
+  0x7b,0x2c,0xb0,0x44,0x17,0x58,0xf2,0x58,0x60,0x5f,0x4b,0x02,0x33,0x61,0xbe,0x3d,
+  0xd2,0x02,0xa0,0x0b,0x5f,0xbe,0xe3,0xf2,0x03,0x10,0x8a,0xbf,0xac,0x47,0x72,0x4c,
+  0x1e,0xc9,0xf1,0xab,0x92,0xe3,0xd7,0x47,0x72,0x44,0xbf,0x47,0xca,0xe8,0x26,0x57,
+  0x43,0x59,0xa5,0x0c,0x23,0x5c,0x76,0x0c,0xdb,0xa6,0x42,0x57,0x57,0x64,0xe4,0x41,
+  0x82,0xe8,0x2f,0x0a,0x0c,0xf2,0x4a,0x58,0x97,0x92,0x48,0x09,0x05,0xe7,0x55,0x80,
+  0x75,0xbe,0x23,0x07,0x22,0xab,0x22,0x1a,0xc1,0x58,0xee,0x89,0xf5,0x22,0x57,0xa9,
+  0x04,0xa2,0xbc,0x9a,0x21,0xd2,0x14,0x54,0xaf,0xa9,0xe3,0x67,0xb4,0x1d,0x4b,0x1f,
+  0xae,0x8f,0x3c,0x85,0xb8,0x88,0xb1,0x45,0x1f,0x87,0x09,0x48,0x31,0x2a,0x90,0xa3,
+  0x74,0x84,0x8c,0x09,0x71,0x46,0xc3,0xe1,0x82,0xd4,0x46,0x09,0x68,0x28,0xc8,0x3a,
+  0xa4,0x7e,0x0d,0xa5,0xcf,0x92,0xc8,0xaf,0xa0,0xdf,0xc3,0x8b,0xee,0xdf,0x6f,0x4e,
+  0x8f,0x3f,0x21,0x54,0x6d,0xe1,0x3f,0x89,0x4c,0x2f,0xbe,0x70,0x21,0x91,0x3b,0xc8,
+  0xb5,0xfb,0xf8,0xbd,0xbe,0x43,0x4e,0x8f,0xee,0x4b,0xa3,0xf6,0xbf,0x48,0xc0,0x2c,
+  0xc7,0xc1,0xb0,0xd7,0x2d,0xde,0x8b,0x03,0xe4,0x6a,0x11,0xe0,0xcf,0xad,0xef,0x77,
+  0x38,0x7a,0xd6,0x89,0x7c,0xec,0x1e,0x9c,0x7d,0xfe,0xf4,0xa1,0x2b,0xd0,0xf5,0x4e,
+  0x01,0xbe,0x79,0xeb,0xc1,0xfe,0x87,0x1f,0xce,0x0e,0x0f,0x71,0x2a,0xd1,0xe1,0x4d,
+  0x0e,0xbf,0x79,0x46,0x4d,0x21,0x9f,0x3e,0x45,0xbd,0xac,0xd2,0x92,0xbb,0x98,0x3d,
+  0xfc,0x82,0xa7,0x74,0xbc,0x9e,0xc9,0xf5,0x09,0x32,0xfe,0x24,0x0b,0xe2,0x91,0x78,
+  0xd5,0x4d,0x46,0x91,0x3f,0xde,0xc8,0xe9,0xf5,0x80,0xcb,0x18,0xc2,0x93,0x1c,0x57,
+  0x62,0x4b,0xa5,0xd4,0xa1,0xb5,0x3c,0xaa,0x49,0x88,0x26,0x2e,0x8e,0x2d,0x02,0x6f,
+  0x6c,0x1b,0x98,0xa8,0xf1,0xad,0xd7,0xef,0x9e,0xe3,0x36,0xae,0xb6,0xea,0x5b,0x2d,
+  0xf8,0xcf,0x3f,0xe2,0x87,0xfc,0xa9,0x7e,0xe5,0xbf,0xf1,0xe4,0x8b,0x1f,0xaa,0x32,
+  0x1a,0x1f,0x87,0x2e,0xc5,0x33,0x95,0xd7,0xbc,0xdc,0xb1,0x85,0xc2,0xd1,0x93,0x06,
+  0xdf,0x09,0x62,0x73,0x8a,0xf5,0x74,0xf0,0x52,0x5e,0x0e,0x2c,0xc5,0xc9,0x4d,0xe0,
+  0xcc,0x4d,0x6c,0x10,0x0f,0x5e,0x68,0x4e,0xbc,0x3a,0x99,0x5a,0x1c,0x86,0x14,0x34,
+  0x44,0xb2,0x1f,0x6a,0x51,0x16,0xb9,0xdb,0xe3,0xb1,0x50,0x1c,0x10,0x41,0xc8,0x0c,
+  0x87,0xd0,0x83,0x1b,0x87,0x9c,0x20,0x05,0x8b,0x8f,0x7d,0x67,0x48,0xcd,0xe6,0x4f,
+  0x07,0xe6,0xfb,0x5d,0xf3,0x27,0x77,0xf9,0x7a,0x65,0x6d,0x9a,0xef,0x5f,0xfd,0xe4,
+  0x5a,0x56,0x13,0x80,0x06,0xf8,0x31,0x8b,0xbb,0xb3,0xa3,0xfb,0x9a,0x02,0x2b,0x00,
+  0x12,0x9c,0x8c,0x74,0x8f,0x3f,0x75,0x61,0x06,0x3c,0xef,0x05,0xf0,0x00,0x8e,0x07,
+  0x22,0x2f,0xf5,0xf8,0x19,0x97,0xe9,0xdc,0x61,0xea,0x4f,0x3e,0x7a,0x63,0x8f,0x35,
+  0xce,0xa3,0xd4,0xc3,0x45,0x5a,0x95,0xe5,0x5e,0x7a,0x6c,0xf2,0x19,0x8b,0x3d,0x3e,
+  0xda,0x3e,0xca,0xb1,0xce,0xb9,0xa5,0x6d,0x22,0x71,0x66,0x6b,0xb7,0x81,0x9d,0x2d,
+  0x0b,0x9c,0xa6,0xdb,0xc3,0xa3,0x5c,0xf3,0x6d,0x9d,0x18,0x78,0x50,0x80,0xec,0x85,
+  0x64,0x51,0xaa,0x73,0x9b,0xbc,0x95,0x0b,0x0c,0x73,0x8a,0x3e,0x4f,0x86,0x80,0xae,
+  0x0d,0xdf,0xc6,0x6c,0xa2,0xa1,0x88,0x38,0x4a,0x0f,0x01,0x91,0xf2,0x83,0x2d,0xe8,
+  0xc3,0xa7,0x03,0xcf,0xb4,0xd5,0x32,0xf9,0xaa,0x20,0xdd,0x6f,0x15,0x07,0xde,0x5b,
+  0x8d,0xbd,0x16,0xfa,0xd9,0xc6,0xde,0x16,0x8f,0xc1,0x39,0x15,0x51,0xf5,0x10,0x12,
+  0x07,0x2a,0x38,0x5f,0x03,0x44,0xde,0x28,0x91,0x57,0xc7,0xe1,0xa2,0x9b,0x17,0xc8,
+  0x2d,0x2a,0x20,0x02,0x31,0x1a,0x0f,0xbf,0xf9,0x71,0x00,0xa4,0x41,0x26,0xbe,0xf3,
+  0x76,0x5b,0x1d,0xef,0x1d,0x90,0xeb,0x78,0x9b,0x9b,0xa5,0x02,0xd4,0x70,0x22,0x76,
+  0x74,0xe5,0xc9,0xc3,0x56,0x1c,0xbe,0x09,0xe9,0x8d,0xc7,0xfd,0xb1,0xb6,0x20,0xac,
+  0xaf,0xde,0xbe,0xcb,0xf6,0xbe,0x59,0x0e,0x27,0xab,0x77,0xcd,0x6c,0x0f,0xeb,0x0a,
+  0xc3,0x49,0xe9,0x90,0x75,0xa4,0xb1,0x40,0x2c,0xde,0xc3,0x0d,0xe4,0x2e,0xb5,0x68,
+  0xff,0x37,0xf2,0x9a,0x4f,0xd0,0xc2,0xfc,0xc3,0xe3,0xa5,0x77,0xb9,0x5b,0x4b,0x2d,
+  0x01,0xb4,0xa7,0xe2,0x69,0x79,0x83,0xa6,0x4e,0xb9,0x4a,0x94,0x6b,0x87,0xcb,0x3f,
+  0x56,0x9f,0xc3,0x9a,0x99,0x07,0xb9,0x60,0x72,0xd4,0x3f,0x3d,0x41,0x9f,0xff,0x58,
+  0xdf,0x4a,0x5e,0xae,0x2e,0x2c,0xfc,0x2a,0x37,0xd6,0x6b,0xfd,0xf8,0x27,0x7d,0xf6,
+  0x76,0x05,0x3f,0xfa,0x74,0x06,0xb4,0x38,0xcb,0x48,0x7d,0x0b,0xc6,0x54,0xce,0x14,
+  0x84,0x85,0xae,0x99,0xa6,0x14,0x3c,0xc0,0x7c,0xdc,0xcc,0xe7,0x6c,0x40,0xa7,0x26,
+  0x18,0x01,0x8a,0x22,0xbc,0x1b,0xe0,0x47,0xc2,0xef,0x2e,0x70,0x85,0xe6,0xc2,0xd0,
+  0x9c,0x9f,0x55,0xce,0x65,0xca,0x6d,0x7c,0x3b,0x55,0x8f,0x58,0x29,0xe1,0xa2,0xb6,
+  0x55,0xbc,0xa9,0x96,0x64,0xa9,0xdb,0x04,0x45,0x9a,0xb6,0xde,0xf5,0xaa,0x52,0x10,
+  0xcf,0x3d,0x20,0x61,0xc8,0x08,0xcb,0xc2,0xf7,0x4a,0x7d,0x9e,0xaa,0x3f,0x97,0x4e,
+  0xea,0xd5,0x68,0x60,0x7a,0x1c,0x53,0x5f,0x1c,0x68,0xd0,0x50,0xd1,0xa8,0xba,0x6f,
+  0x20,0x52,0x22,0x5b,0xa1,0x26,0xd1,0x5b,0x84,0x4b,0x25,0x95,0xae,0x42,0xad,0xd7,
+  0x47,0x0a,0xb5,0x14,0x3e,0xce,0x4c,0xa2,0x41,0x96,0x42,0x5a,0x5b,0x5c,0xa4,0xc0,
+  0x45,0xf1,0x7b,0x14,0x82,0xb4,0xba,0x4d,0xa1,0x05,0xb8,0x3c,0xbd,0x3b,0x80,0xa0,
+  0x85,0x09,0x1a,0x55,0x85,0x6a,0x71,0xfe,0x26,0xcb,0xd7,0x34,0x99,0xd1,0x64,0x44,
+  0xc3,0x36,0xd9,0x1f,0xa4,0x3c,0x39,0x80,0x57,0x62,0xeb,0x21,0xcf,0xcb,0x42,0x48,
+  0x0b,0xf8,0x31,0x5e,0x81,0xf2,0x08,0x4d,0x40,0x1b,0xf8,0xe0,0x94,0xdf,0x27,0x21,
+  0xff,0xf3,0x9f,0xff,0x4d,0x9c,0xec,0xe1,0x9f,0x58,0x4c,0x84,0xcf,0xa7,0x8c,0xdd,
+  0xc3,0xaf,0x89,0x03,0xae,0x23,0xcc,0xef,0xdc,0x88,0xbb,0x08,0x63,0x3c,0x37,0x9e,
+  0xb0,0xb5,0xb9,0x1b,0xdf,0xd1,0xe4,0x5e,0x77,0xc2,0x1c,0x41,0x96,0x4f,0x96,0xb8,
+  0xe1,0x21,0x9e,0x21,0x93,0x7b,0xb2,0x52,0x8a,0x0f,0x3d,0x01,0x63,0x2a,0x50,0x57,
+  0x0d,0xb2,0x13,0xc9,0xed,0x32,0x02,0xc8,0x83,0x5c,0x15,0x0a,0x94,0x38,0x49,0x9a,
+  0x64,0x7b,0x6d,0x89,0x4b,0xce,0x5a,0xc6,0x9f,0xd6,0xf2,0xc9,0x89,0x20,0x80,0xae,
+  0x41,0x28,0xf5,0x62,0x19,0xfa,0xa0,0xef,0xc8,0x36,0xaf,0x83,0xd8,0x12,0x23,0x5b,
+  0x05,0xb2,0x7c,0x4a,0x8f,0xab,0xaa,0xa4,0x36,0xfd,0x3b,0x8d,0x75,0x9d,0x79,0x3d,
+  0x2a,0x78,0x2c,0xd7,0x5b,0x60,0xe9,0x86,0x0f,0x6a,0x64,0xbe,0x37,0x6d,0x2b,0x65,
+  0x3d,0xb5,0x9e,0x3a,0xb9,0xd4,0x48,0x2d,0xd7,0xb9,0x1c,0x19,0x87,0x7e,0xef,0x56,
+  0x54,0xf1,0x6f,0xb5,0xf1,0x22,0xa7,0xf0,0x42,0xab,0x5f,0xae,0x37,0x64,0xad,0x4e,
+  0xb7,0xf1,0xdb,0xde,0xe0,0x49,0x5f,0xf0,0x94,0xd1,0xeb,0xfe,0x3b,0x2e,0x71,0xab,
+  0x0a,0xa4,0x05,0xd0,0xab,0x04,0x1e,0x05,0xe4,0xeb,0x39,0x38,0xe7,0x3c,0x7b,0x7c,
+  0x94,0xf6,0x38,0x36,0x94,0xe7,0x2e,0x2e,0x0f,0xbd,0x70,0x6e,0x88,0xc3,0xd5,0x70,
+  0xf4,0xe4,0x72,0x62,0xed,0xce,0xd8,0x1a,0x2d,0x29,0x2e,0x28,0xbd,0x74,0xee,0xc6,
+  0xcb,0xe7,0x16,0x8c,0xaf,0xac,0xa0,0xf0,0x59,0xf9,0xcd,0x23,0x19,0x2a,0xc7,0xc9,
+  0xc3,0xbf,0x06,0x34,0x41,0x8e,0x69,0xd0,0x5b,0xac,0xa1,0x78,0xb3,0x09,0x99,0x11,
+  0x69,0xc9,0xb8,0x2f,0xb1,0x20,0x87,0x2e,0xeb,0x98,0x5f,0x9d,0x4f,0xde,0x7d,0x92,
+  0x13,0x8e,0x28,0xe0,0x89,0xdf,0x9a,0xaf,0xf1,0x3b,0xe7,0xd3,0x12,0xc3,0xe2,0x72,
+  0x28,0x40,0xba,0xf0,0x2e,0xe1,0xd8,0x03,0x50,0x2d,0x2f,0x1e,0x7d,0xc8,0x92,0x34,
+  0x02,0x6f,0x52,0xce,0x0e,0xfb,0xdd,0x93,0xee,0xe9,0xcd,0x07,0xbc,0xa5,0x79,0x65,
+  0xa4,0x30,0x98,0x26,0x46,0xdd,0x60,0xf3,0x18,0xcf,0x41,0xe1,0x5b,0x3a,0x4b,0x8c,
+  0xeb,0x4e,0xa9,0xf3,0x0f,0xdd,0xee,0x39,0x26,0x93,0xdb,0x0a,0xe4,0x16,0x77,0x3b,
+  0xb3,0xf0,0x8e,0x51,0x12,0x27,0x11,0xf9,0xc1,0x81,0x2c,0x1c,0xf1,0xaa,0xbc,0x7a,
+  0x29,0x29,0x30,0x5c,0xa1,0x2c,0x6e,0xa8,0xa9,0xf3,0xfa,0xfd,0x10,0x5d,0x15,0xef,
+  0x71,0x35,0xc4,0x3a,0xe9,0x72,0xc8,0x97,0x8c,0x55,0xb5,0x69,0xfb,0xea,0x9a,0x1f,
+  0x06,0xae,0x3f,0xd3,0x52,0x1b,0x5f,0x08,0x56,0x23,0x12,0xce,0x11,0x6f,0x34,0xca,
+  0x37,0x69,0x55,0xaf,0x1f,0xca,0xc9,0x26,0xd7,0x45,0x39,0xff,0xd9,0xaa,0xd1,0x2d,
+  0xaf,0x1a,0x31,0x35,0xdb,0xfb,0xe1,0x64,0x97,0x23,0xe4,0x6f,0xc5,0x4a,0xe1,0x81,
+  0xd9,0xe2,0xeb,0xea,0xb6,0x54,0x63,0xc3,0x8a,0x8a,0xc5,0x13,0x74,0x50,0x7e,0x5a,
+  0xae,0x16,0xb9,0x5a,0xb5,0x48,0x9c,0x99,0xe9,0x17,0xe9,0x24,0x3d,0x0e,0x9a,0x15,
+  0x71,0x0b,0xbe,0x4d,0x51,0x62,0xd7,0x32,0x0b,0x3e,0x79,0xf8,0x75,0x78,0x47,0xf1,
+  0xa4,0x09,0x81,0x9f,0x93,0x8d,0x06,0x4e,0x46,0xd5,0xe5,0x41,0xd1,0x17,0x7e,0xda,
+  0x30,0xdf,0xd0,0x61,0x40,0x73,0x6a,0xd9,0xa9,0xef,0x41,0x36,0xd7,0x28,0x44,0x9a,
+  0xcf,0xaa,0x66,0x41,0x28,0x6b,0x87,0x00,0x4d,0x65,0x39,0xa6,0x5c,0x89,0x29,0x1f,
+  0xe2,0xc9,0x6a,0x0d,0x9e,0xc2,0x42,0x7e,0xa1,0x89,0xa3,0x6c,0x12,0xe8,0x99,0xcf,
+  0x46,0xe6,0x70,0xa2,0x81,0x86,0xa9,0x2e,0x07,0x7b,0xaa,0x25,0x9d,0x53,0xa5,0xfd,
+  0xef,0xc9,0xf4,0x6a,0xaa,0x99,0xc2,0x35,0x1e,0x72,0x36,0x8c,0x32,0xed,0xca,0xc4,
+  0xc5,0x04,0xc3,0xe9,0x73,0xa0,0x9c,0x4f,0xfd,0xc1,0x09,0xa7,0x4e,0x5a,0x5c,0x31,
+  0x1a,0x4e,0xf5,0x90,0x22,0xc8,0xe0,0xb1,0xde,0x70,0x8a,0xe3,0x39,0x54,0x9f,0x33,
+  0xd3,0xd8,0x76,0xc5,0x90,0xca,0x46,0x6c,0x61,0x47,0x62,0x2f,0x63,0x9b,0xc7,0xbc,
+  0x0b,0xbc,0xcf,0xd3,0xe2,0x86,0x0d,0x44,0x66,0x9e,0xcb,0x4f,0x4a,0xa6,0xf6,0x84,
+  0xdf,0x0e,0x54,0x13,0xe7,0x9b,0xdc,0x03,0x7b,0xd7,0x95,0xd5,0x8f,0x74,0x5c,0x02,
+  0x59,0xe4,0xd4,0xc2,0x0a,0x80,0x8e,0x8a,0xf8,0x4b,0xfd,0xe8,0x23,0x8d,0x9d,0x50,
+  0xef,0xb0,0xc5,0x47,0x34,0x80,0x96,0xec,0x36,0xc6,0x12,0x78,0x74,0x47,0x7b,0x78,
+  0xcb,0x00,0x7a,0xf2,0xad,0x05,0x71,0xc6,0xa8,0xcb,0x5f,0x99,0x39,0xd3,0x78,0xf5,
+  0x1b,0xd4,0xc7,0x8f,0x12,0x35,0x74,0x40,0xc7,0x5e,0x78,0x0e,0xb4,0x95,0xba,0x4e,
+  0x73,0x3b,0x36,0x17,0x75,0xe2,0x69,0xe8,0x3f,0x4f,0x9b,0xd1,0xdd,0x79,0x80,0x95,
+  0x14,0x07,0x00,0xab,0x99,0x9a,0x4f,0x51,0x4e,0x4e,0x1b,0xb1,0x10,0x4c,0x17,0x5c,
+  0x82,0x0e,0xdb,0xf0,0x31,0x17,0x62,0x13,0x40,0xc8,0xd4,0xdb,0xde,0x58,0x40,0x0f,
+  0x37,0xad,0x99,0x0f,0x2c,0x63,0x8c,0x27,0xe5,0xb4,0x1f,0x99,0xf1,0xbc,0x0e,0x04,
+  0xd5,0x3d,0xd4,0xb1,0x8d,0xb7,0x93,0xb5,0xd7,0x42,0x8b,0x2b,0xac,0x91,0x37,0x9f,
+  0x8b,0x04,0x6f,0x86,0x66,0x21,0xd5,0x98,0x3b,0xc7,0xe7,0xef,0x1c,0x72,0x7d,0x78,
+  0xfa,0xf2,0x41,0x0f,0x6f,0x02,0xe4,0xd4,0x84,0xf7,0xb5,0xf0,0x8a,0xc1,0xf9,0xe5,
+  0x85,0xde,0xa4,0xfc,0x31,0x6f,0xeb,0x89,0x36,0xbe,0x14,0x3c,0xd8,0x6b,0x18,0x78,
+  0x17,0xa4,0xc1,0xef,0x2b,0xe2,0xcb,0x26,0x96,0xf5,0x60,0xba,0xe8,0xd0,0x9b,0x53,
+  0xd7,0xdc,0xb6,0xf0,0xba,0x59,0x39,0x50,0xe8,0x7f,0x39,0x40,0xcc,0x2f,0x67,0x17,
+  0xcd,0x8b,0x93,0x6e,0x43,0xde,0x54,0xc2,0x60,0x71,0x98,0x38,0x01,0xc5,0xfb,0x0a,
+  0x29,0x96,0x63,0xaa,0x15,0xc5,0x83,0x9b,0x4b,0x1e,0x00,0xde,0xd6,0xf1,0xfb,0x91,
+  0xf6,0xfd,0xe0,0xc7,0x7e,0x17,0xcb,0x5f,0xbc,0xcb,0x77,0xa2,0xb5,0x49,0xde,0x76,
+  0x8a,0x91,0xe7,0x67,0x27,0x27,0xf9,0x41,0x7c,0x35,0x80,0x60,0xfa,0x42,0x78,0x90,
+  0x24,0x0f,0xff,0x85,0x09,0x78,0x16,0x8e,0x8b,0xa1,0xc7,0x1f,0x4f,0x64,0x15,0x71,
+  0xab,0x55,0x1e,0x0b,0x43,0xd3,0xc8,0xc7,0x43,0x29,0x95,0x4c,0xf2,0x43,0x13,0x39,
+  0x74,0x84,0xb7,0x32,0x97,0x83,0x6c,0xd4,0xe6,0x47,0x1c,0x9f,0xbd,0x90,0xbd,0xdd,
+  0x4f,0x12,0x67,0x61,0xaa,0x15,0x5b,0x18,0x61,0x08,0x1e,0x3b,0x20,0x97,0xfa,0x20,
+  0xf8,0x30,0x6d,0x93,0x77,0xad,0xf9,0xdb,0x16,0x77,0xaa,0x9b,0x5b,0xe4,0x60,0x81,
+  0x57,0x8c,0x1e,0x7e,0x05,0xc0,0x90,0xc6,0x58,0x82,0xa1,0x61,0x9d,0xec,0xed,0xe6,
+  0x5d,0x1a,0xad,0xf9,0xf7,0x87,0xb2,0x17,0x30,0xb4,0x72,0x75,0xeb,0x70,0x60,0xe2,
+  0xa9,0x30,0x1e,0xde,0x2c,0x46,0xc8,0x5b,0x05,0x92,0xf3,0x67,0x58,0xa5,0x0d,0x4b,
+  0xb4,0x47,0x9e,0xef,0x9b,0xa2,0x28,0xcf,0x8b,0x39,0xf8,0xe7,0x14,0x75,0x7e,0x45,
+  0x92,0xff,0x55,0xc5,0x6c,0xe2,0x81,0x61,0xc6,0xe4,0x1d,0x41,0x7a,0xca,0x5d,0xf0,
+  0xb2,0xca,0xbb,0x5c,0x00,0x8f,0xe2,0x1c,0xf6,0xbd,0x8a,0x37,0x37,0xaf,0xf3,0x14,
+  0x83,0xe1,0x6d,0x72,0x58,0xbb,0xb5,0x84,0x91,0x9b,0xe0,0xb8,0x10,0xe7,0x74,0x8a,
+  0x08,0x25,0x8f,0x2e,0x55,0x4d,0x09,0x1d,0x09,0xda,0x18,0x6e,0xb2,0x03,0x4f,0x7b,
+  0x58,0xe1,0x0a,0x1b,0x0d,0xb5,0xec,0x2b,0x0f,0x88,0x93,0xff,0xa8,0xcc,0xb4,0x7a,
+  0xe4,0xa0,0x81,0x0f,0x2f,0xf6,0xcc,0xa3,0xc1,0xff,0x8b,0x5b,0xf6,0x02,0xec,0x02,
+  0x6e,0x38,0xa1,0x00,0x9d,0x8e,0x03,0x67,0x4c,0x3f,0xc2,0x22,0x51,0xf6,0x97,0x42,
+  0x7f,0x2d,0xbd,0x7a,0xb6,0xe0,0x9c,0x26,0x0b,0xc1,0xce,0x23,0xf8,0x96,0x17,0xd1,
+  0x54,0x97,0xb9,0xe8,0x32,0x17,0x5d,0x2e,0xe1,0x5b,0xde,0xa5,0xe4,0xea,0x16,0x75,
+  0xe1,0xc0,0xb8,0x15,0x88,0xd2,0xde,0x5c,0x15,0xdf,0x23,0xc6,0x8f,0x91,0xc8,0x6b,
+  0x7e,0x6d,0xc5,0x09,0xc8,0x5f,0x69,0xf2,0xf0,0x0b,0x2b,0x11,0x19,0xe2,0xcd,0x03,
+  0xc9,0xdf,0x18,0x81,0xa8,0x09,0xe4,0xf6,0xf6,0xc8,0x6b,0x4b,0x98,0xd6,0xe5,0x35,
+  0x3e,0xe1,0xcb,0x6f,0xc9,0xf7,0x96,0x05,0x3f,0xb7,0xc0,0x13,0x6c,0xef,0xec,0x80,
+  0x27,0x68,0x95,0x1d,0x29,0x86,0x0f,0xf0,0x9b,0x62,0x18,0x50,0x9a,0x23,0x89,0x37,
+  0xb9,0xa3,0x0c,0xc6,0xfc,0xd2,0xc2,0x55,0x84,0xb0,0xab,0x78,0x42,0x9d,0x78,0xf4,
+  0x66,0x1b,0xdf,0x0c,0x1f,0x0f,0x85,0xa6,0xd7,0xd7,0xfc,0x8f,0x7d,0x76,0x3a,0x25,
+  0x44,0x30,0xb6,0x21,0xa4,0x14,0x7c,0x87,0x11,0x3c,0x0c,0xb6,0xd6,0x26,0x08,0x78,
+  0x29,0x44,0x29,0x09,0xbf,0x83,0x83,0xb8,0x68,0x57,0xb3,0x7e,0xa5,0x0b,0xb9,0xda,
+  0x4c,0x3c,0xd7,0xa5,0xa1,0xe4,0xff,0x0b,0x11,0xdc,0x68,0xf0,0x7e,0x0a,0x60,0x0d,
+  0x78,0x3b,0x5d,0xdd,0xd6,0x01,0x68,0x82,0xdf,0xa1,0x6d,0x23,0x8c,0x1a,0x29,0x03,
+  0x40,0x63,0x94,0x0e,0x48,0x4b,0x67,0x56,0xdb,0xe0,0x5a,0xd5,0x0c,0x24,0xb7,0xed,
+  0x8a,0x5b,0x51,0x68,0xce,0xc1,0xa7,0x83,0x6c,0x34,0xa2,0x89,0x69,0x81,0x8f,0xa9,
+  0x1c,0xc5,0x7d,0x69,0x1c,0x0e,0x1a,0x3f,0x48,0x07,0x60,0x58,0xc2,0x9b,0x6f,0x19,
+  0xf9,0xdc,0x24,0x37,0x99,0xe2,0x4d,0xc1,0x0f,0xe9,0x48,0x55,0xd3,0x4a,0x5f,0x30,
+  0x82,0x4d,0xdc,0xdc,0x33,0xe7,0x80,0x7c,0x72,0xe9,0xe0,0x0d,0x7e,0x4d,0xd3,0x68,
+  0x19,0xda,0x79,0xe0,0x0b,0xe1,0x9e,0x56,0x6a,0x10,0xa2,0xab,0xf3,0x25,0x0a,0xd9,
+  0x56,0xb3,0x95,0xea,0xd9,0x9b,0x76,0x09,0xaa,0xb3,0x91,0xe2,0x2d,0x3d,0x08,0x80,
+  0x53,0xc7,0xcf,0xab,0x16,0x28,0x68,0x75,0x85,0xa8,0x32,0x18,0xcb,0x15,0x5b,0x3b,
+  0xad,0x56,0x41,0xb6,0x84,0x3a,0x75,0x6a,0xd5,0xf6,0x3a,0xbf,0xe3,0x05,0x9d,0x94,
+  0xb2,0x75,0x36,0xfe,0x17,0x6d,0x1c,0x62,0x3c,0x7e,0x37,0x00,0x00,
+};
+
+// index.html: 2952 -> 1057 Bytes
+static const uint8_t WEB_INDEX_HTML[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x56,0x4b,0x6e,0xf3,0x36,
+  0x10,0xde,0xfb,0x14,0xac,0xba,0x48,0x0a,0x44,0xb1,0xec,0xf8,0x15,0xd7,0x56,0x91,
+  0xc7,0xa2,0x05,0xfe,0x00,0x69,0xdc,0x20,0x6b,0x9a,0x1a,0x4b,0x6c,0x28,0x52,0x15,
+  0x29,0x3b,0x0e,0x7a,0x84,0x5e,0xa0,0xab,0xde,0xa2,0x17,0xe8,0x85,0x7a,0x84,0x0e,
+  0x29,0x59,0x7e,0x44,0xbf,0x7e,0xb4,0xdd,0x58,0xc3,0xf1,0x7c,0xf3,0xf8,0x38,0x24,
+  0x67,0xf6,0x55,0xa4,0x98,0xd9,0x66,0x40,0x12,0x93,0x8a,0x70,0x66,0x7f,0x89,0xa0,
+  0x32,0x9e,0x7b,0x11,0x78,0x61,0x67,0x96,0x00,0x8d,0xf0,0x93,0x82,0xa1,0x84,0x25,
+  0x34,0xd7,0x60,0xe6,0x5e,0x61,0x56,0xfe,0xc4,0xdb,0xa9,0x25,0x4d,0x61,0xee,0xad,
+  0x39,0x6c,0x32,0x95,0x1b,0x8f,0x30,0x25,0x0d,0x48,0x34,0xdb,0xf0,0xc8,0x24,0xf3,
+  0x08,0xd6,0x9c,0x81,0xef,0x16,0x17,0x84,0x4b,0x6e,0x38,0x15,0xbe,0x66,0x54,0xc0,
+  0xbc,0x67,0x9d,0x18,0x6e,0x04,0x84,0x4f,0x34,0xe2,0x8a,0x3c,0x41,0xaa,0x0c,0xcc,
+  0xba,0xa5,0xae,0x33,0x13,0x5c,0xbe,0x92,0x1c,0xc4,0xdc,0xd3,0x66,0x2b,0x40,0x27,
+  0x00,0x18,0x21,0xc9,0x61,0x35,0xf7,0xba,0x34,0xcb,0x2e,0x99,0xd6,0xdf,0xad,0xe7,
+  0x03,0xd6,0xeb,0x0d,0x26,0x83,0x6b,0xeb,0xae,0x5b,0xa5,0xbc,0x54,0xd1,0x36,0xec,
+  0x74,0x66,0x11,0x5f,0x13,0x26,0xa8,0xd6,0x73,0xcf,0xa8,0x6c,0x49,0x73,0x34,0x22,
+  0xc4,0xa9,0x9d,0x4f,0xac,0x94,0xeb,0x4c,0xd0,0xed,0x74,0x25,0xe0,0xed,0x5b,0x12,
+  0xd3,0x6c,0xda,0x0b,0x32,0x94,0xa8,0xe0,0xb1,0xf4,0xb9,0x81,0x54,0x4f,0x19,0x56,
+  0x04,0x25,0x14,0xc1,0xcb,0xc2,0x18,0x25,0x09,0x8f,0x10,0x4c,0xf3,0xd7,0x5b,0x23,
+  0xbd,0x5d,0x8c,0xa5,0x95,0x95,0x64,0x82,0xb3,0x57,0x1b,0x31,0x8e,0x05,0xdc,0xa3,
+  0xcd,0xf9,0x37,0x1e,0x71,0x55,0xcd,0x3d,0xbb,0x24,0x0f,0x2a,0x02,0x52,0xa4,0x1a,
+  0x49,0x15,0x48,0x97,0x17,0xfe,0xfd,0xc7,0x6f,0xbf,0xcf,0xba,0xa5,0x67,0xcc,0xdb,
+  0xc5,0x39,0xc8,0x3d,0xe3,0x42,0x54,0xe1,0xf1,0x0f,0x9d,0xd1,0x32,0xbc,0x80,0xa8,
+  0x0e,0xed,0xe4,0xaa,0xa6,0x25,0x65,0xaf,0x71,0xae,0x0a,0x19,0x4d,0xbf,0x66,0x41,
+  0xe0,0x85,0xb3,0xae,0xc5,0x7c,0x74,0x80,0xbb,0x25,0x7f,0x82,0x37,0xe3,0x85,0xf7,
+  0x5c,0xdb,0x05,0x30,0x03,0xd1,0xa1,0xf5,0xac,0x8b,0x69,0x84,0xcd,0x09,0x39,0x17,
+  0xcb,0x42,0x6f,0x1f,0xdd,0xea,0x84,0x50,0xa9,0x24,0xd4,0x55,0xbb,0x0d,0xf6,0x7f,
+  0x2c,0xa0,0x00,0xb2,0x56,0x42,0x5c,0x90,0x5b,0x58,0x41,0x22,0x80,0x6c,0x20,0x8f,
+  0x40,0x92,0x35,0xe4,0xef,0x7f,0xfd,0x19,0x03,0xf6,0xd0,0x71,0x9a,0x5f,0x28,0x0f,
+  0x26,0x2d,0xe5,0xd9,0xdc,0xca,0xf2,0x6e,0x51,0x6a,0x2c,0xab,0x12,0xaa,0xa6,0xf8,
+  0xb8,0xc3,0x96,0x94,0x93,0x1d,0x26,0x59,0xce,0x53,0x9a,0x6f,0x3f,0xec,0xf4,0x5d,
+  0x49,0x20,0x6e,0x76,0x58,0x89,0xfb,0x2d,0x3d,0xf4,0xdb,0xd8,0x2c,0x42,0x31,0x6a,
+  0xb8,0x92,0x97,0xae,0xbf,0xcf,0xba,0x78,0xd6,0x8a,0xec,0xcc,0x0b,0x17,0xf6,0x7b,
+  0xe8,0xa7,0xca,0x78,0x97,0xf8,0xe1,0xae,0xa4,0x85,0xb1,0x34,0xd9,0xbc,0x25,0x98,
+  0x1f,0xe4,0x4a,0x59,0x6e,0x3e,0xda,0xe5,0x6a,0x53,0x93,0x89,0x95,0xc4,0x5c,0xfa,
+  0x78,0x3a,0xa6,0xbd,0x7e,0xf6,0xb6,0x3f,0x1f,0x95,0x2d,0xa3,0x79,0xb4,0xeb,0xfc,
+  0x64,0x18,0x3e,0xe6,0x80,0x99,0x69,0x3c,0x68,0xc3,0x8f,0x5d,0xa1,0x21,0xae,0xfd,
+  0xda,0x93,0x14,0xec,0xf7,0xf2,0x80,0xd2,0xec,0x51,0x60,0xa5,0x7b,0x4a,0x29,0x33,
+  0x7c,0x0d,0x07,0x54,0x60,0x80,0x32,0xcc,0xf9,0x19,0x9a,0x72,0x79,0x86,0x84,0x3a,
+  0xe1,0x98,0xce,0x13,0xaf,0xbd,0x66,0x0f,0x3d,0x8b,0xee,0xb5,0x22,0xfb,0xcd,0xc8,
+  0xbe,0x45,0xf6,0x5b,0x91,0x57,0xcd,0xc8,0x2b,0x8b,0xbc,0x6a,0x45,0x0e,0x9a,0x91,
+  0x03,0x8b,0x1c,0xb4,0x22,0x87,0xcd,0xc8,0xa1,0x45,0x0e,0x5b,0x91,0xa3,0x66,0xe4,
+  0xc8,0x22,0x47,0xad,0xc8,0x71,0x33,0x72,0x6c,0x91,0xe3,0x56,0xe4,0xa4,0x19,0x39,
+  0xb1,0xc8,0x49,0x2b,0xf2,0xba,0x19,0x79,0x6d,0x91,0xd7,0x27,0x07,0xab,0xf9,0x34,
+  0x7f,0xa6,0x85,0x6f,0xc1,0xe4,0x1c,0x96,0x9a,0xe6,0xe6,0xf3,0x6d,0xdc,0x94,0x52,
+  0xfa,0x69,0x71,0x7b,0x9c,0x94,0xbd,0xc7,0xcf,0xcf,0x50,0x6d,0x93,0xc2,0x4f,0x5b,
+  0x41,0xe9,0xb3,0x45,0xb7,0xf4,0x7c,0xe9,0xec,0xb9,0x74,0xf6,0xfc,0x05,0x67,0x77,
+  0x2f,0x4d,0xe0,0xbb,0x17,0x8b,0xbd,0x7b,0x69,0x85,0xde,0x3c,0x34,0x41,0x6f,0x1e,
+  0x2c,0xf4,0xe6,0xa1,0x9d,0xd9,0xa6,0xdb,0xc4,0xd1,0xdb,0x76,0x9d,0x74,0x1c,0xbb,
+  0x28,0xd8,0xf0,0xab,0x1c,0x7e,0xb9,0x2f,0x9f,0x08,0x0f,0x55,0x15,0xcc,0x05,0x5b,
+  0xe1,0xec,0xe0,0x6b,0xfe,0x0e,0xd3,0xab,0x09,0x3e,0xc1,0x7b,0xdd,0x06,0x78,0x9c,
+  0x98,0xe9,0x24,0x08,0x4a,0xa5,0x00,0x83,0xef,0xb1,0x8f,0xd7,0x39,0xe3,0x32,0x9e,
+  0xf6,0x77,0xc6,0x06,0xef,0x7a,0xdf,0x3d,0xdc,0xd5,0x93,0x5d,0xaa,0x0b,0x6d,0x8d,
+  0x41,0xe0,0x85,0xec,0x5e,0xa5,0x52,0x9b,0xd1,0x28,0xb2,0xe8,0x61,0xf6,0x46,0x82,
+  0x83,0x60,0x2b,0x9a,0x72,0xb1,0x9d,0x16,0xdc,0x4f,0x95,0x54,0x36,0x06,0x5c,0xd4,
+  0x92,0xb5,0x73,0x35,0x8d,0x48,0x30,0x1e,0x92,0x20,0x08,0xc8,0xf7,0xef,0x9d,0x9a,
+  0xa5,0x9a,0x9f,0x7f,0x47,0x90,0xed,0xca,0x8a,0x93,0x5d,0x47,0xce,0x18,0x95,0x6b,
+  0xaa,0x4b,0xca,0x96,0x77,0x6e,0x51,0x77,0x8f,0x72,0xaf,0x61,0x39,0x61,0x79,0xbd,
+  0x3e,0x9e,0xb1,0xc4,0x31,0x54,0x2e,0xf0,0xca,0x2f,0xc1,0xff,0x71,0xbb,0x6c,0x36,
+  0x0b,0xff,0x01,0x90,0xbf,0xa6,0x6c,0x0c,0x12,0x99,0x9e,0x24,0xe4,0x74,0x75,0x46,
+  0x23,0x1c,0x39,0xea,0x8c,0x46,0xc1,0x61,0x42,0xc7,0x07,0xed,0xe0,0xbd,0x72,0x1e,
+  0xca,0x17,0x6b,0x31,0x25,0x3e,0xf9,0x95,0x3c,0xbe,0x3c,0x95,0xc2,0xc2,0x09,0xff,
+  0xa7,0x01,0x6d,0x45,0x9f,0x54,0x5c,0x57,0x63,0xb1,0x6e,0x7e,0x52,0xf1,0x7e,0x7e,
+  0x42,0x39,0x3c,0x0d,0xa2,0x59,0xce,0x33,0x43,0x74,0xce,0x70,0xe2,0x34,0x09,0xa4,
+  0x70,0xf9,0xb3,0x1d,0x39,0x27,0x51,0x14,0x8d,0x86,0xc3,0x2b,0x37,0x7a,0x38,0x9b,
+  0xf0,0xc4,0xd8,0x8e,0xa7,0xce,0x14,0x7a,0xcb,0xc9,0x68,0x3c,0x1e,0x1e,0x99,0x76,
+  0xdd,0x7c,0x8a,0xf9,0xd8,0xb9,0xbb,0xf3,0x0f,0x7f,0x02,0xd3,0xf2,0x88,0x0b,0x00,
+  0x00,
+};
+
+// setup.html: 1575 -> 735 Bytes
+static const uint8_t WEB_SETUP_HTML[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x55,0x4d,0x4f,0x1b,0x31,
+  0x10,0xbd,0xef,0xaf,0x70,0x7d,0xe8,0x26,0x12,0xd9,0x2d,0x04,0x2a,0x1a,0x76,0x53,
+  0xd1,0x96,0x03,0x55,0x05,0xa8,0x41,0xaa,0xd4,0x9b,0x63,0x4f,0xb2,0x06,0xaf,0xbd,
+  0xb2,0xbd,0x09,0x51,0xc8,0x3f,0xeb,0xad,0x7f,0xac,0xe3,0x5d,0x96,0x06,0xaa,0x20,
+  0xd1,0x4b,0xe2,0x8f,0x79,0x2f,0x6f,0xde,0x8c,0x27,0xd9,0x1b,0x61,0xb8,0x5f,0x55,
+  0x40,0x0a,0x5f,0xaa,0x71,0x16,0x3e,0x89,0x62,0x7a,0x9e,0x53,0x01,0x74,0x1c,0x65,
+  0x05,0x30,0x81,0x5f,0x25,0x78,0x46,0x78,0xc1,0xac,0x03,0x9f,0xd3,0xda,0xcf,0x06,
+  0xc7,0xb4,0x3b,0xd6,0xac,0x84,0x9c,0x2e,0x24,0x2c,0x2b,0x63,0x3d,0x25,0xdc,0x68,
+  0x0f,0x1a,0xc3,0x96,0x52,0xf8,0x22,0x17,0xb0,0x90,0x1c,0x06,0xcd,0x66,0x8f,0x48,
+  0x2d,0xbd,0x64,0x6a,0xe0,0x38,0x53,0x90,0xef,0x07,0x12,0x2f,0xbd,0x82,0xf1,0x04,
+  0x7c,0x5d,0x65,0x69,0xbb,0x89,0x32,0x25,0xf5,0x2d,0xb1,0xa0,0x72,0xea,0xfc,0x4a,
+  0x81,0x2b,0x00,0x90,0xba,0xb0,0x30,0xcb,0x69,0xca,0xaa,0x2a,0xe1,0xce,0x7d,0x5c,
+  0xe4,0x87,0x7c,0x7f,0xff,0xf0,0xf8,0xf0,0x43,0xe0,0x49,0x1f,0xb4,0x4e,0x8d,0x58,
+  0x05,0xe5,0x07,0x1d,0x27,0xae,0xa2,0x28,0x13,0x72,0x41,0xb8,0x62,0xce,0xe5,0x94,
+  0x33,0x2b,0x10,0x41,0x48,0x56,0x0c,0xc7,0x93,0xeb,0x53,0xf2,0xe3,0xdb,0xe9,0x05,
+  0xc6,0x0d,0x9b,0xb3,0xad,0xc0,0xb2,0xf6,0x80,0x91,0x93,0xc9,0xf9,0x17,0xf2,0x96,
+  0x5c,0xe1,0xd9,0x12,0x53,0x24,0x4b,0xb0,0x02,0x34,0x91,0x25,0x39,0x9b,0x5c,0x0d,
+  0x0f,0xc8,0x1c,0x5c,0x05,0x92,0x17,0x80,0x77,0x3d,0xe7,0xad,0x29,0x95,0x71,0xa4,
+  0x02,0xeb,0xa4,0x0b,0x56,0xf4,0x93,0x2c,0x45,0x56,0x54,0xf1,0x94,0xde,0x9a,0x25,
+  0x25,0x4d,0x7e,0xf8,0x53,0xcc,0xce,0xa5,0x1e,0x78,0x53,0x8d,0xf6,0xdf,0x55,0x77,
+  0x8d,0x3c,0x8c,0x56,0x6c,0x0a,0xaa,0x11,0x90,0xa5,0xed,0xba,0x3d,0x97,0xba,0xaa,
+  0x3d,0x91,0x02,0xfd,0x71,0x52,0xd0,0x8e,0x51,0x33,0xdb,0x90,0x56,0x8a,0x71,0x28,
+  0x8c,0x12,0x60,0x73,0x1a,0xb2,0x1b,0x5c,0x60,0x95,0xda,0x9c,0x5b,0x29,0xff,0xa9,
+  0xa4,0xf3,0x60,0x97,0x9a,0x0a,0xef,0x5f,0x56,0xd3,0x31,0x50,0x12,0xfa,0xae,0x45,
+  0xe0,0x5e,0x6c,0x8b,0x7b,0xbd,0xba,0x69,0xed,0xbd,0xd1,0x1d,0x60,0xea,0x35,0xa9,
+  0xac,0xc4,0xd8,0x15,0x25,0x46,0x73,0x25,0xf9,0x2d,0x3a,0xc5,0x16,0xd0,0xeb,0x63,
+  0x39,0x1f,0x8a,0xa5,0xb3,0xb4,0x85,0xed,0xe2,0xd8,0xc2,0x5a,0x98,0x1a,0xe3,0x03,
+  0xfa,0x7b,0xb3,0x7a,0x05,0x54,0x19,0xce,0xbc,0x34,0x3a,0x69,0xba,0x37,0x4e,0x63,
+  0x3a,0xfe,0x59,0xdb,0xdf,0xbf,0xf8,0xed,0x36,0xc9,0xb3,0xcc,0x83,0x97,0xa5,0x9b,
+  0xd3,0xa7,0x9d,0xb8,0xd3,0x84,0x07,0x74,0x47,0x92,0x39,0x6e,0x65,0xe5,0x89,0xb3,
+  0x1c,0x9f,0x8b,0x2f,0xa0,0x84,0xe4,0x26,0xbc,0x97,0x63,0x21,0xc4,0xfb,0xa3,0xa3,
+  0x61,0x40,0xb4,0x31,0xe3,0x2e,0x78,0x1c,0x31,0xb7,0xd2,0x9c,0xcc,0x6a,0xcd,0x83,
+  0x5c,0xd2,0xda,0xb5,0x46,0x45,0xf8,0xa2,0x1d,0x92,0x61,0xa3,0x91,0x9c,0xe0,0xc0,
+  0xa8,0x4b,0x6c,0xea,0x64,0x0e,0xfe,0x4c,0x41,0x58,0x7e,0x5a,0x9d,0x8b,0x5e,0x1c,
+  0xee,0xe3,0x7e,0xb2,0x60,0xaa,0x06,0x72,0x7f,0x4f,0x28,0x3d,0x79,0xc4,0x86,0x22,
+  0xbf,0x84,0x0d,0xf7,0xbb,0xb0,0x16,0x81,0x6c,0xc9,0xa4,0x27,0x33,0xf0,0xbc,0xe8,
+  0xc5,0xf8,0xfe,0x65,0xba,0x94,0x33,0x19,0xef,0x91,0x75,0xe3,0x3f,0xce,0xa1,0xc2,
+  0x88,0x51,0x7c,0x75,0x39,0xb9,0x8e,0xf7,0x9a,0xa3,0x30,0x0c,0xf0,0x01,0x8e,0xd6,
+  0xf1,0xe7,0x76,0x1e,0x0d,0xae,0xb1,0xdd,0xe2,0x51,0x8c,0xc3,0x03,0xeb,0xd2,0x54,
+  0x24,0xbd,0x71,0x46,0xc7,0x9b,0x16,0x10,0xc6,0xc6,0x88,0x7c,0x9d,0x5c,0x5e,0x24,
+  0xf8,0x84,0xa5,0x9e,0xcb,0xd9,0xaa,0xb7,0x0e,0x49,0xed,0x35,0xf2,0x37,0x7d,0x0c,
+  0xdb,0xf4,0xff,0xea,0xf2,0x8f,0xba,0x6c,0xe2,0xe1,0x0e,0x9b,0x23,0xdc,0xed,0x4c,
+  0x11,0xab,0x89,0x19,0x86,0xc0,0x07,0x41,0x08,0xf7,0x27,0xd1,0x26,0x7a,0xee,0x7b,
+  0xd7,0x6a,0xeb,0xd7,0xb2,0xd1,0xb6,0x35,0x51,0x7a,0x92,0x24,0x8d,0x81,0xff,0xda,
+  0xd6,0x92,0x07,0xe3,0x9e,0x78,0x16,0xf2,0xda,0x44,0x5b,0x3d,0x91,0x36,0x53,0x14,
+  0x67,0x62,0xf8,0x5b,0x88,0xfe,0x00,0xcb,0xd7,0x9d,0x4b,0x27,0x06,0x00,0x00,
+};
+
+// theme.js: 588 -> 346 Bytes
+static const uint8_t WEB_THEME_JS[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x75,0x91,0x4d,0x4e,0xc3,0x30,
+  0x10,0x85,0xf7,0x39,0xc5,0x90,0x4d,0x1d,0xa9,0x4a,0x60,0x4b,0x15,0x21,0x15,0xba,
+  0xa8,0x04,0xab,0x9e,0xc0,0x71,0x26,0xa9,0x85,0x63,0x57,0xf6,0x54,0x10,0x55,0x91,
+  0x38,0x00,0x12,0x5b,0x58,0x71,0x0d,0x16,0xec,0xb8,0x09,0x17,0x80,0x23,0xe0,0x24,
+  0x6d,0x69,0xf8,0xd9,0xd8,0x96,0x3d,0x6f,0xe6,0x7b,0xcf,0x49,0x02,0x17,0xdc,0x5e,
+  0xc3,0x95,0xc9,0x71,0x0c,0x25,0x56,0x28,0xb5,0xe3,0x15,0x14,0x6f,0xaf,0x16,0xb8,
+  0x52,0x08,0x0b,0x94,0x84,0x1a,0xd8,0xcc,0x3f,0x10,0x2a,0xb5,0xd6,0x25,0xc8,0x0a,
+  0x94,0x11,0x5c,0x2d,0xc8,0x58,0x5e,0x62,0x14,0x04,0xc5,0x5a,0x0b,0x92,0x46,0x03,
+  0x5f,0xad,0x54,0xdd,0xb6,0x64,0xd2,0xb5,0x5b,0xb4,0x09,0x00,0x72,0x23,0xd6,0x15,
+  0x6a,0x8a,0x33,0x93,0xd7,0xb1,0x50,0xdc,0xb9,0x4b,0xe9,0x28,0x26,0x53,0x96,0x0a,
+  0xd9,0x28,0xf7,0x85,0xa3,0x31,0x6c,0x15,0x13,0xaf,0x10,0xc6,0x4f,0x83,0x0c,0xd2,
+  0x6f,0x6d,0x89,0x34,0x53,0xd8,0x1e,0xa7,0xf5,0x3c,0xef,0x45,0x53,0xd2,0xa3,0xae,
+  0x5e,0x16,0x2c,0x8b,0x20,0x8b,0x09,0x6f,0xe9,0xdc,0x68,0x4f,0x4c,0x5e,0xdb,0x37,
+  0x84,0x33,0x08,0xdf,0x1f,0xef,0x3e,0x5e,0x1e,0x42,0x38,0x85,0xf0,0xf3,0xf9,0xfe,
+  0x29,0x9c,0x04,0xcd,0x01,0x74,0xcf,0xd1,0x51,0x77,0xbc,0xfd,0xf4,0xad,0x3a,0x85,
+  0xa3,0xff,0xf8,0x7d,0x1d,0x71,0x9f,0xcb,0xd6,0x41,0x47,0xf2,0x2b,0x80,0xf6,0x92,
+  0x6c,0xbd,0x19,0x44,0x16,0x3b,0xa4,0x39,0x61,0xf5,0xc3,0x7b,0x8b,0x7a,0xd2,0x51,
+  0x1e,0x87,0xd1,0x04,0x1a,0xc1,0x49,0x2c,0x19,0x46,0x9b,0xa6,0xe5,0x4d,0x12,0xc8,
+  0xd0,0x67,0xbf,0x20,0x6e,0x09,0x6e,0x24,0xe6,0x68,0x97,0x68,0xbb,0x6f,0x41,0x1d,
+  0xb0,0x9d,0x9f,0xde,0x84,0xc2,0x03,0x0b,0x05,0x57,0x0e,0xf7,0x24,0xfb,0xeb,0x01,
+  0x52,0x39,0x40,0x8a,0x20,0x4d,0xd3,0x96,0x66,0x88,0xf1,0xa7,0xc1,0x26,0x62,0x7e,
+  0xfd,0x02,0x32,0x44,0x85,0x1e,0x4c,0x02,0x00,0x00,
+};
+
+const WebAsset WEB_ASSETS[] = {
+  { "/app.css", "text/css; charset=utf-8", WEB_APP_CSS, 888, "\"4c11484992a77af8\"", true },
+  { "/app.js", "application/javascript; charset=utf-8", WEB_APP_JS, 5357, "\"e1b86775fe1625f3\"", true },
+  { "/", "text/html; charset=utf-8", WEB_INDEX_HTML, 1057, "\"2a3de13cba31586b\"", false },
+  { "/setup", "text/html; charset=utf-8", WEB_SETUP_HTML, 735, "\"9b049f823b1ca94c\"", false },
+  { "/theme.js", "application/javascript; charset=utf-8", WEB_THEME_JS, 346, "\"8ddd6553aaee66d5\"", true },
+};
+
+const uint8_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
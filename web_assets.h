@@ -0,0 +1,17 @@
+#pragma once
+#include <Arduino.h>
+
+// Statische Web-Dateien, gzip-komprimiert im Flash.
+// Erzeugt von tools/gen_web_assets.py aus web/ – nicht von Hand ändern.
+
+struct WebAsset {
+  const char* path;          // URL, z.B. "/" oder "/app.css"
+  const char* content_type;
+  const uint8_t* gz;         // PROGMEM, Content-Encoding: gzip
+  uint32_t gz_len;
+  const char* etag;          // starker ETag inkl. Anführungszeichen
+  bool immutable;            // per ?v=<hash> versioniert -> lange cachen
+};
+
+extern const WebAsset WEB_ASSETS[];
+extern const uint8_t WEB_ASSET_COUNT;
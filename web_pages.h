@@ -1,4 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-extern const char INDEX_HTML[] PROGMEM;
\ No newline at end of file
@@ -2,12 +2,42 @@
 #include "wifi_manager.h"
 #include "wifi_config.h"
 #include "radio_link.h"
-#include "web_pages.h"
-#include "setup_page.h"
+#include "app_state.h"
+#include "app_events.h"
+#include "latency_trace.h"
+#include "web_assets.h"
+#include "telemetry.h"
+#include "display.h"
+#include "display_mirror.h"
+#include "config_display.h"
 
-static String readBody(WebServer& server) {
-  if (server.hasArg("plain")) return server.arg("plain");
-  return "";
+// Handler laufen in der AsyncTCP-Task, nicht in loop(). Zusammenhängende
+// Daten lesen sie nur über Zugriffe, die gegen loop() gesichert sind:
+// app_state_snapshot() (Seqlock), telemetry_read() (portMUX) und für den
+// OLED-Spiegel displayFrameCopy(). Direkt gelesen werden nur einzelne
+// Zähler/Statistiken (schlimmstenfalls ein halb aktualisierter Zählerstand).
+// Alles, was radio_link oder app_state verändert, geht über die
+// Befehls-Mailbox an loop() (webui_loop()) – ein langsamer Client hält dort
+// nichts auf.
+
+// POST-Body einsammeln, höchstens WEB_BODY_MAX Bytes; _tempObject gibt die
+// Bibliothek mit dem Request frei
+static void collectBody(AsyncWebServerRequest* req, uint8_t* data, size_t len, size_t index, size_t total) {
+  if (total > WEB_BODY_MAX) return;   // Handler antwortet 413
+  if (index == 0) req->_tempObject = calloc(total + 1, 1);
+  if (!req->_tempObject || index + len > total) return;
+  memcpy((uint8_t*)req->_tempObject + index, data, len);
+}
+
+static bool bodyTooLarge(AsyncWebServerRequest* req) {
+  if (req->contentLength() <= WEB_BODY_MAX) return false;
+  req->send(413, "text/plain", "body too large");
+  return true;
+}
+
+static String readBody(AsyncWebServerRequest* req) {
+  if (!req->_tempObject) return "";
+  return String((const char*)req->_tempObject);
 }
 
 static String extractJsonString(const String& body, const char* key) {
@@ -32,16 +62,29 @@ static long extractJsonNumber(const String& body, const char* key) {
   return body.substring(s, e).toInt();
 }
 
-static void handleRoot(WebServer& server) {
-  server.send(200, "text/html; charset=utf-8", INDEX_HTML);
-}
-
-static void handleSetup(WebServer& server){
-  server.send(200, "text/html; charset=utf-8", SETUP_HTML);
+// Seiten, CSS und JS aus web_assets.cpp (tools/gen_web_assets.py): immer
+// gzip, starker ETag. Seiten prüft der Browser bei jedem Laden nach (304,
+// solange unverändert), CSS/JS sind per ?v=<hash> versioniert und bleiben
+// ein Jahr im Cache.
+static void handleAsset(AsyncWebServerRequest* req, const WebAsset& a) {
+  const char* cache = a.immutable ? "public, max-age=31536000, immutable" : "no-cache";
+  if (req->hasHeader("If-None-Match") && req->header("If-None-Match").indexOf(a.etag) >= 0) {
+    AsyncWebServerResponse* r = req->beginResponse(304);
+    r->addHeader("ETag", a.etag);
+    r->addHeader("Cache-Control", cache);
+    req->send(r);
+    return;
+  }
+  AsyncWebServerResponse* r = req->beginResponse_P(200, a.content_type, a.gz, a.gz_len);
+  r->addHeader("Content-Encoding", "gzip");
+  r->addHeader("ETag", a.etag);
+  r->addHeader("Cache-Control", cache);
+  req->send(r);
 }
 
-static void handleWifiSave(WebServer& server){
-  String body = readBody(server);
+static void handleWifiSave(AsyncWebServerRequest* req){
+  if (bodyTooLarge(req)) return;
+  String body = readBody(req);
   Serial.println("[API WIFI] " + body);
 
   String ssid = extractJsonString(body, "ssid");
@@ -49,89 +92,531 @@ static void handleWifiSave(WebServer& server){
 
   // Minimal-Check: SSID muss gesetzt sein
   if (ssid.length() == 0) {
-    server.send(400, "text/plain", "SSID fehlt.");
+    req->send(400, "text/plain", "SSID fehlt.");
     return;
   }
 
   bool ok = wifi_cfg_save(ssid, pass);
-  server.send(ok ? 200 : 500, "text/plain", ok ? "Gespeichert. Reboot drücken, um zu verbinden." : "Speichern fehlgeschlagen.");
+  req->send(ok ? 200 : 500, "text/plain", ok ? "Gespeichert. Reboot drücken, um zu verbinden." : "Speichern fehlgeschlagen.");
+}
+
+// Neustart erst aus loop(), damit die Antwort noch rausgeht
+static volatile uint32_t rebootAtMs = 0;
+
+static void handleReboot(AsyncWebServerRequest* req){
+  req->send(200, "text/plain", "OK");
+  rebootAtMs = millis() + 200;
+  if (!rebootAtMs) rebootAtMs = 1;
+}
+
+// Annahme durch die Radio-Queue ehrlich weitergeben (WebSocket-Antwort,
+// Ablehnungen der Vorab-Prüfung auch per HTTP).
+//   200 queued/sent | 429 queue_full | 503 not_ready | 400 unsupported
+static int admitStatus(RadioAdmit a) {
+  if (a == RadioAdmit::QUEUE_FULL) return 429;
+  if (a == RadioAdmit::NOT_READY) return 503;
+  if (a == RadioAdmit::UNSUPPORTED) return 400;
+  return 200;
 }
 
-static void handleReboot(WebServer& server){
-  server.send(200, "text/plain", "OK");
-  delay(200);
-  ESP.restart();
+// Felder der Antwort (ohne Klammern), für /api/cmd und WebSocket gleich
+static String admitJson(RadioAdmit a) {
+  String json;
+  json += "\"ok\":" + String(radio_admit_ok(a) ? "true" : "false") + ",";
+  json += "\"result\":\"" + String(radio_admit_to_string(a)) + "\",";
+  json += "\"depth\":" + String(radio_queue_depth()) + ",";
+  json += "\"capacity\":" + String(radio_queue_capacity()) + ",";
+  json += "\"retry_ms\":" + String(radio_retry_after_ms());
+  return json;
 }
 
-static void handleCmd(WebServer& server) {
-  String body = readBody(server);
-  Serial.println("[API CMD] " + body);
+// ---------- Befehls-Mailbox (AsyncTCP-Task -> loop()) ----------
+// Feste Plätze, kein Heap; voll -> 429. client = WebSocket-Client, der die
+// Antwort bekommt, 0 = HTTP (Ergebnis kommt per Push bzw. /api/state).
+struct WebCmd {
+  char body[WEB_CMD_MAX];
+  uint32_t t0_us;
+  uint32_t client;
+  uint32_t id;
+};
+
+static WebCmd mailbox[WEB_CMD_QUEUE_LEN];
+static uint8_t mbHead = 0, mbCount = 0;
+static uint32_t mbNextId = 1;
+static portMUX_TYPE mbMux = portMUX_INITIALIZER_UNLOCKED;
 
+// Rückgabe: Befehls-ID (fortlaufend, für das Log), 0 = Mailbox voll bzw. zu lang
+static uint32_t postCmd(const uint8_t* data, size_t len, uint32_t t0_us, uint32_t client) {
+  if (len >= WEB_CMD_MAX) return 0;
+  uint32_t id = 0;
+  portENTER_CRITICAL(&mbMux);
+  if (mbCount < WEB_CMD_QUEUE_LEN) {
+    WebCmd& c = mailbox[(mbHead + mbCount) % WEB_CMD_QUEUE_LEN];
+    memcpy(c.body, data, len);
+    c.body[len] = '\0';
+    c.t0_us = t0_us;
+    c.client = client;
+    c.id = id = mbNextId++;
+    if (!mbNextId) mbNextId = 1;
+    mbCount++;
+  }
+  portEXIT_CRITICAL(&mbMux);
+  return id;
+}
+
+static bool takeCmd(WebCmd& out) {
+  bool have = false;
+  portENTER_CRITICAL(&mbMux);
+  if (mbCount) {
+    out = mailbox[mbHead];
+    mbHead = (uint8_t)((mbHead + 1) % WEB_CMD_QUEUE_LEN);
+    mbCount--;
+    have = true;
+  }
+  portEXIT_CRITICAL(&mbMux);
+  return have;
+}
+
+// Befehl aus einem JSON-Body {"cmd":..., ...} ausführen (nur loop()).
+// t0_us = Eingang, für die Latenzmessung.
+static RadioAdmit runCmd(const String& body, uint32_t t0_us) {
+  latency_input_begin(LatencyOrigin::Web, t0_us);
   String cmd = extractJsonString(body, "cmd");
+  RadioAdmit a = RadioAdmit::UNSUPPORTED;
 
   if (cmd == "connect") {
-    radio_send_connect();
-    // global_radio_state.radio_connected = true;
+    a = radio_send_connect();
   } else if (cmd == "disconnect") {
-    radio_send_disconnect();
-    // global_radio_state.radio_connected = false;
+    a = radio_send_disconnect();
   } else if (cmd == "preset") {
     String v = extractJsonString(body, "value");
     if (v.length()) {
-      global_radio_state.preset = v;
-      radio_send_preset(v);
+      a = radio_send_preset(v);
+      if (radio_admit_ok(a)) app_state_set_preset((uint8_t)constrain(v.toInt(), 0, 9));   // "Plain" -> 0
     }
   } else if (cmd == "mode") {
     String v = extractJsonString(body, "value");
     if (v.length()) {
-      global_radio_state.mode_str = v;
-      radio_send_mode(v);
+      a = radio_send_mode(v);   // AppState::mode folgt mit dem ACK
     }
   } else if (cmd == "freq") {
     long hz = extractJsonNumber(body, "hz");
-    if (hz >= 0) {
-      // global_radio_state.freq_hz = (uint32_t)hz;
-      // if(global_radio_state.freq_hz < 1500000){
-      //   Serial.println("Freq < 1.500 MHz");
-      //   radio_send_rx_freq(global_radio_state.freq_hz);
-      // } else {
-      //   radio_send_freq(global_radio_state.freq_hz);
-      // }
-      radio_send_freq(global_radio_state.freq_hz);
+    if (hz > 0) {
+      a = radio_send_freq((uint32_t)hz);
     }
   }
+  latency_input_end();
+  return a;
+}
 
-  server.send(200, "text/plain", "OK");
+// Vorab-Prüfung in der AsyncTCP-Task, ohne das Radio anzufassen: Befehl und
+// Argument aus dem Body, Link-Zustand aus dem Snapshot. In die Mailbox kommt
+// nur, was loop() auch ausführen kann.
+//   QUEUED = ausführbar | UNSUPPORTED (400) | NOT_READY (503)
+static RadioAdmit precheckCmd(const String& body, const AppState& s) {
+  String cmd = extractJsonString(body, "cmd");
+  bool (*accepts)(RadioState, bool) = radio_link_accepts;
+  if (cmd == "connect" || cmd == "disconnect") {
+    accepts = radio_link_accepts_remote;
+  } else if (cmd == "preset") {
+    if (!extractJsonString(body, "value").length()) return RadioAdmit::UNSUPPORTED;
+  } else if (cmd == "mode") {
+    if (radio_mode_from_name(extractJsonString(body, "value")) == RadioMode::UNKNOWN) return RadioAdmit::UNSUPPORTED;
+    accepts = radio_link_accepts_mode;
+  } else if (cmd == "freq") {
+    if (extractJsonNumber(body, "hz") <= 0) return RadioAdmit::UNSUPPORTED;
+  } else {
+    return RadioAdmit::UNSUPPORTED;
+  }
+  return accepts(s.link, radio_link_stats().lost) ? RadioAdmit::QUEUED : RadioAdmit::NOT_READY;
+}
+
+// POST /api/cmd: prüfen und annehmen, ausgeführt wird in loop().
+//   202 accepted (+id) | 400 unbekannt/ungültig | 503 Radio nicht bereit
+//   429 Radio-Queue oder Mailbox voll (+Retry-After) | 413 zu lang
+static void handleCmd(AsyncWebServerRequest* req) {
+  uint32_t t0 = micros();   // Body ist komplett da: Eingang für die Latenz
+  if (bodyTooLarge(req)) return;
+
+  AppState s;
+  app_state_snapshot(s);
+  const char* body = req->_tempObject ? (const char*)req->_tempObject : "";
+  if (strlen(body) >= WEB_CMD_MAX) {
+    req->send(413, "text/plain", "command too long");
+    return;
+  }
+  RadioAdmit pre = precheckCmd(String(body), s);
+  if (pre != RadioAdmit::QUEUED) {
+    req->send(admitStatus(pre), "application/json", "{" + admitJson(pre) + "}");
+    return;
+  }
+  uint32_t id = s.busy ? 0 : postCmd((const uint8_t*)body, strlen(body), t0, 0);
+
+  String json = "{";
+  json += "\"ok\":" + String(id ? "true" : "false") + ",";
+  json += "\"result\":\"" + String(id ? "accepted" : "queue_full") + "\",";
+  json += "\"id\":" + String(id) + ",";
+  json += "\"depth\":" + String(radio_queue_depth()) + ",";
+  json += "\"capacity\":" + String(radio_queue_capacity()) + ",";
+  json += "\"retry_ms\":" + String(id ? 0 : radio_retry_after_ms());
+  json += "}";
+
+  AsyncWebServerResponse* r = req->beginResponse(id ? 202 : 429, "application/json", json);
+  if (!id) {
+    // Retry-After ist in Sekunden; genauer steht's im JSON
+    r->addHeader("Retry-After", String((radio_retry_after_ms() + 999) / 1000));
+  }
+  req->send(r);
 }
 
-static void handleState(WebServer& server) {
+// JSON-Teil aus einem AppState-Snapshot: nur neu bauen, wenn AppBus eine
+// Änderung gemeldet hat, nicht bei jedem Poll. Der Snapshot hält Frequenz,
+// Mode und Verbindung zusammen, auch wenn radio_link gerade schreibt.
+static String stateJson;
+static volatile bool stateJsonStale = true;
+
+// Geänderte Gruppen für den WebSocket-Push (liveJson)
+enum : uint8_t {
+  LIVE_FREQ   = 1 << 0,
+  LIVE_MODE   = 1 << 1,
+  LIVE_LINK   = 1 << 2,
+  LIVE_PRESET = 1 << 3,
+  LIVE_WIFI   = 1 << 4,   // nur beim Verbinden
+  LIVE_ALL    = 0x1F
+};
+static volatile uint8_t liveDirty = 0;
+
+void WebEvents::on(const FrequencyChanged&) { stateJsonStale = true; liveDirty |= LIVE_FREQ; }
+void WebEvents::on(const ModeChanged&)      { stateJsonStale = true; liveDirty |= LIVE_MODE; }
+void WebEvents::on(const LinkStateChanged&) { stateJsonStale = true; liveDirty |= LIVE_LINK; }
+void WebEvents::on(const PresetChanged&)    { stateJsonStale = true; liveDirty |= LIVE_PRESET; }
+
+static const String& radioStateJson() {
+  if (stateJsonStale) {
+    // vor dem Snapshot zurücksetzen: ein Event währenddessen markiert erneut
+    stateJsonStale = false;
+    AppState s;
+    uint32_t v = app_state_snapshot(s);
+    stateJson = "\"v\":" + String(v) + ",";
+    stateJson += "\"radio_connected\":" + String(s.connected ? "true" : "false") + ",";
+    stateJson += "\"freq_hz\":" + String(s.freq_hz) + ",";
+    stateJson += "\"freq_radio_hz\":" + String(s.freq_radio_hz) + ",";
+    stateJson += "\"freq_seq\":" + String(s.freq_seq) + ",";
+    stateJson += "\"freq_confirmed\":" + String(app_state_freq_confirmed(s) ? "true" : "false") + ",";
+    stateJson += "\"mode\":\"" + radio_mode_to_string(s.mode) + "\",";
+    stateJson += "\"preset\":\"" + app_state_preset_name(s.preset) + "\",";
+  }
+  return stateJson;
+}
+
+static void handleState(AsyncWebServerRequest* req) {
   WiFiStatusInfo w = wifi_get_status();
+  RadioLinkStats link = radio_link_stats();
 
   String json = "{";
-  json += "\"radio_connected\":" + String(global_radio_state.radio_connected ? "true" : "false") + ",";
-  json += "\"freq_hz\":" + String(global_radio_state.freq_hz) + ",";
-  json += "\"mode\":\"" + global_radio_state.mode_str + "\",";
-  json += "\"preset\":\"" + global_radio_state.preset + "\",";
+  json += radioStateJson();
+  json += "\"link_lost\":" + String(link.lost ? "true" : "false") + ",";
+  json += "\"link_losses\":" + String(link.losses) + ",";
+  json += "\"link_detect_ms\":" + String(link.last_detect_ms) + ",";
+  json += "\"link_reconnect_ms\":" + String(link.last_reconnect_ms) + ",";
+  json += "\"queue_depth\":" + String(radio_queue_depth()) + ",";
+  json += "\"queue_busy\":" + String(radio_queue_busy() ? "true" : "false") + ",";
   json += "\"wifi_mode\":\"" + w.wifi_mode + "\",";
   json += "\"sta_ip\":\"" + w.sta_ip + "\",";
   json += "\"ap_ip\":\"" + w.ap_ip + "\"";
   json += "}";
 
-  server.send(200, "application/json", json);
+  req->send(200, "application/json", json);
 }
 
-void webui_setup(WebServer& server) {
-  server.on("/", HTTP_GET, [&server]() { handleRoot(server); });
-  server.on("/api/cmd", HTTP_POST, [&server]() { handleCmd(server); });
-  server.on("/api/state", HTTP_GET, [&server]() { handleState(server); });
-  server.on("/setup", HTTP_GET, [&server]() { handleSetup(server); });
-  server.on("/api/wifi", HTTP_POST, [&server]() { handleWifiSave(server); });
-  server.on("/api/reboot", HTTP_POST, [&server]() { handleReboot(server); });
+// GET /api/telemetry?ch=smeter&cursor=<n>
+// Liefert ab cursor höchstens RADIO_TELEMETRY_HTTP_MAX Samples; der Client
+// fragt beim nächsten Mal mit "next" weiter.
+static void handleTelemetry(AsyncWebServerRequest* req) {
+  TelemetryChannel ch = TelemetryChannel::SMETER;
+  if (req->hasArg("ch") && !telemetry_channel_from_name(req->arg("ch"), ch)) {
+    req->send(400, "text/plain", "unknown channel");
+    return;
+  }
+  uint32_t cursor = req->hasArg("cursor") ? (uint32_t)req->arg("cursor").toInt() : 0;
+
+  static int16_t samples[RADIO_TELEMETRY_HTTP_MAX];
+  uint16_t n = telemetry_read(ch, cursor, samples, RADIO_TELEMETRY_HTTP_MAX);
+
+  String json;
+  json.reserve(96 + n * 7);
+  json += "{";
+  json += "\"ch\":\"" + String(telemetry_channel_name(ch)) + "\",";
+  json += "\"period_ms\":" + String(radio_telemetry_period_ms()) + ",";
+  json += "\"cursor\":" + String(cursor) + ",";
+  json += "\"next\":" + String(cursor + n) + ",";
+  json += "\"v\":[";
+  for (uint16_t i = 0; i < n; i++) {
+    if (i) json += ",";
+    json += String(samples[i]);
+  }
+  json += "]}";
+
+  req->send(200, "application/json", json);
+}
+
+// Zehntel als Dezimalzahl, z.B. 125 -> "12.5"
+static String tenths(uint16_t v) {
+  return String(v / 10) + "." + String(v % 10);
+}
+
+template <uint8_t N>
+static String histogramJson(const Log2Histogram<N>& h) {
+  String json = "{";
+  json += "\"n\":" + String(h.total()) + ",";
+  json += "\"p50\":" + String(h.percentile(50)) + ",";
+  json += "\"p95\":" + String(h.percentile(95)) + ",";
+  json += "\"p99\":" + String(h.percentile(99)) + ",";
+  json += "\"buckets\":[";
+  for (uint8_t i = 0; i < N; i++) {
+    if (i) json += ",";
+    json += String(h.count[i]);
+  }
+  json += "]}";
+  return json;
+}
+
+// GET /api/metrics – Laufzeitmetriken (derzeit Display). Histogramme sind
+// log2: buckets[0] = 0, buckets[i] = [2^(i-1), 2^i), letzter nach oben offen.
+static void handleMetrics(AsyncWebServerRequest* req) {
+  DisplayFlushStats d = displayFlushStats();
+
+  String json;
+  json.reserve(3200);
+  json += "{\"display\":{";
+  json += "\"async\":" + String(d.async ? "true" : "false") + ",";
+  json += "\"min_refresh_ms\":" + String(UI_MIN_REFRESH_MS) + ",";
+  json += "\"fps\":" + tenths(d.fps_x10) + ",";
+  json += "\"loop_load_pct\":" + tenths(d.load_permille) + ",";
+  json += "\"frames\":" + String(d.frames) + ",";
+  json += "\"full_frames\":" + String(d.full_frames) + ",";
+  json += "\"skipped_frames\":" + String(d.skipped_frames) + ",";
+  json += "\"dropped_frames\":" + String(d.dropped_frames) + ",";
+  json += "\"coalesced\":" + String(d.coalesced) + ",";
+  json += "\"stale_refreshes\":" + String(d.stale_refreshes) + ",";
+  json += "\"frame_interval_ms\":" + String(d.frame_interval_ms) + ",";
+  json += "\"paced\":" + String(d.paced) + ",";
+  json += "\"settle_frames\":" + String(d.settle_frames) + ",";
+  json += "\"i2c_hz\":" + String(d.i2c_hz) + ",";
+  json += "\"i2c_transactions\":" + String(d.transactions) + ",";
+  json += "\"total_bytes\":" + String(d.total_bytes) + ",";
+  json += "\"render_us\":" + histogramJson(d.render_us) + ",";
+  json += "\"flush_us\":" + histogramJson(d.flush_us) + ",";
+  json += "\"frame_bytes\":" + histogramJson(d.frame_bytes);
+  json += "},";
+
+  DisplayMirrorStats m = displayMirrorStats();
+  json += "\"mirror\":{";
+  json += "\"requests\":" + String(m.requests) + ",";
+  json += "\"unchanged\":" + String(m.unchanged) + ",";
+  json += "\"deltas\":" + String(m.deltas) + ",";
+  json += "\"keyframes\":" + String(m.keyframes) + ",";
+  json += "\"bytes\":" + String(m.bytes) + ",";
+  json += "\"last_bytes\":" + String(m.last_bytes);
+  json += "},";
+
+  // Eingabe-Latenz je Quelle und Stufe (µs)
+  json += "\"latency\":{";
+  for (uint8_t o = 0; o < (uint8_t)LatencyOrigin::COUNT; o++) {
+    if (o) json += ",";
+    json += "\"" + String(latency_origin_name((LatencyOrigin)o)) + "\":{";
+    for (uint8_t st = 0; st < (uint8_t)LatencyStage::COUNT; st++) {
+      if (st) json += ",";
+      json += "\"" + String(latency_stage_name((LatencyStage)st)) + "\":";
+      json += histogramJson(latency_histogram((LatencyOrigin)o, (LatencyStage)st));
+    }
+    json += "}";
+  }
+  json += "}}";
+
+  req->send(200, "application/json", json);
+}
+
+// GET /api/fb?v=<version>
+// 204 = Client ist aktuell, sonst Delta bzw. Keyframe (Format: display_mirror.h).
+// X-Fb-Version ist der Stand, den der Client danach hat.
+static void handleFramebuffer(AsyncWebServerRequest* req) {
+  uint32_t clientVersion = req->hasArg("v") ? (uint32_t)req->arg("v").toInt() : 0;
+  size_t len;
+  uint32_t version;
+  bool keyframe;
+  const uint8_t* data = displayMirrorEncode(clientVersion, len, version, keyframe);
+
+  if (!data) {
+    AsyncWebServerResponse* r = req->beginResponse(204);
+    r->addHeader("Cache-Control", "no-store");
+    r->addHeader("X-Fb-Version", String(version));
+    req->send(r);
+    return;
+  }
+  // Kopie in den Puffer der Antwort: data gilt nur bis zum nächsten Aufruf,
+  // gesendet wird aber erst nach dem Handler
+  AsyncResponseStream* r = req->beginResponseStream("application/octet-stream", len);
+  r->addHeader("Cache-Control", "no-store");
+  r->addHeader("X-Fb-Version", String(version));
+  r->addHeader("X-Fb-Keyframe", keyframe ? "1" : "0");
+  r->write(data, len);
+  req->send(r);
+}
+
+// ---------- Live-Status per WebSocket (/ws) ----------
+// Jeder Browser hält eine Verbindung. Beim Verbinden kommt der volle Stand,
+// danach nur die geänderten Gruppen (gleiche Feldnamen wie /api/state),
+// höchstens alle WEB_WS_PUSH_MIN_MS. Befehle kommen als {"cmd":...,"id":n}
+// über dieselbe Verbindung und laufen durch die Mailbox; die Antwort trägt
+// die id. /api/state und /api/cmd bleiben als Fallback ohne WebSocket.
+// Gebaut und gesendet wird der Stand nur in loop().
+static AsyncWebSocket ws("/ws");
+static uint32_t lastPushMs = 0;
+static uint32_t lastPingMs = 0;
+static volatile bool liveFull = false;   // neuer Client: alles senden
+
+static String liveJson(uint8_t groups) {
+  AppState s;
+  uint32_t v = app_state_snapshot(s);
+  String json;
+  json.reserve(320);
+  json += "{\"type\":\"state\",\"v\":" + String(v);
+  if (groups & LIVE_FREQ) {
+    json += ",\"freq_hz\":" + String(s.freq_hz);
+    json += ",\"freq_radio_hz\":" + String(s.freq_radio_hz);
+    json += ",\"freq_seq\":" + String(s.freq_seq);
+    json += ",\"freq_confirmed\":" + String(app_state_freq_confirmed(s) ? "true" : "false");
+  }
+  if (groups & LIVE_MODE) {
+    json += ",\"mode\":\"" + radio_mode_to_string(s.mode) + "\"";
+  }
+  if (groups & LIVE_PRESET) {
+    json += ",\"preset\":\"" + app_state_preset_name(s.preset) + "\"";
+  }
+  if (groups & LIVE_LINK) {
+    RadioLinkStats link = radio_link_stats();
+    json += ",\"radio_connected\":" + String(s.connected ? "true" : "false");
+    json += ",\"link_lost\":" + String(link.lost ? "true" : "false");
+    json += ",\"link_losses\":" + String(link.losses);
+    json += ",\"link_detect_ms\":" + String(link.last_detect_ms);
+    json += ",\"link_reconnect_ms\":" + String(link.last_reconnect_ms);
+    json += ",\"queue_depth\":" + String(radio_queue_depth());
+    json += ",\"queue_busy\":" + String(s.busy ? "true" : "false");
+  }
+  if (groups & LIVE_WIFI) {
+    WiFiStatusInfo w = wifi_get_status();
+    json += ",\"wifi_mode\":\"" + w.wifi_mode + "\"";
+    json += ",\"sta_ip\":\"" + w.sta_ip + "\"";
+    json += ",\"ap_ip\":\"" + w.ap_ip + "\"";
+  }
+  json += "}";
+  return json;
+}
+
+static void sendWsReply(uint32_t client, uint32_t id, int status, const String& fields) {
+  ws.text(client, "{\"type\":\"cmd\",\"id\":" + String(id) + ",\"status\":" + String(status) + "," + fields + "}");
+}
+
+// AsyncTCP-Task: nur annehmen bzw. ablehnen
+static void onWsEvent(AsyncWebSocket*, AsyncWebSocketClient* client, AwsEventType type,
+                      void* arg, uint8_t* data, size_t len) {
+  if (type == WS_EVT_CONNECT) {
+    if (ws.count() > WEB_WS_MAX_CLIENTS) {
+      client->close(1013, "too many clients");
+      return;
+    }
+    liveFull = true;
+  } else if (type == WS_EVT_DATA) {
+    uint32_t t0 = micros();
+    AwsFrameInfo* info = (AwsFrameInfo*)arg;
+    // nur kurze Textnachrichten in einem Frame, der Rest wird verworfen
+    if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT) return;
+    if (len >= WEB_CMD_MAX) {
+      client->text("{\"type\":\"cmd\",\"status\":413,\"ok\":false,\"result\":\"too_long\"}");
+      return;
+    }
+    String body;
+    body.concat((const char*)data, len);
+    uint32_t id = (uint32_t)extractJsonNumber(body, "id");
+    AppState s;
+    app_state_snapshot(s);
+    RadioAdmit pre = precheckCmd(body, s);
+    if (pre != RadioAdmit::QUEUED) {
+      sendWsReply(client->id(), id, admitStatus(pre), admitJson(pre));
+    } else if (!postCmd(data, len, t0, client->id())) {
+      client->text("{\"type\":\"cmd\",\"id\":" + String(id) +
+                   ",\"status\":429,\"ok\":false,\"result\":\"queue_full\",\"retry_ms\":" +
+                   String(radio_retry_after_ms()) + "}");
+    }
+  }
+}
+
+// Mailbox abarbeiten: HTTP-Befehle nur protokollieren, WebSocket-Befehle
+// bekommen das Ergebnis der Radio-Queue
+static void runPendingCmds() {
+  WebCmd c;
+  while (takeCmd(c)) {
+    String body(c.body);
+    RadioAdmit a = runCmd(body, c.t0_us);
+    if (RADIO_DEBUG_MIRROR) {
+      Serial.print(c.client ? "[WS CMD #" : "[API CMD #");
+      Serial.print(c.id);
+      Serial.print("] ");
+      Serial.print(body);
+      Serial.print(" -> ");
+      Serial.println(radio_admit_to_string(a));
+    }
+    if (c.client) sendWsReply(c.client, (uint32_t)extractJsonNumber(body, "id"), admitStatus(a), admitJson(a));
+  }
+}
+
+// Geänderte Gruppen an alle Clients, gebündelt
+static void pushLive() {
+  if (!liveDirty && !liveFull) return;
+  uint32_t now = millis();
+  if (now - lastPushMs < WEB_WS_PUSH_MIN_MS) return;
+  if (!ws.count()) {
+    liveDirty = 0;
+    return;
+  }
+  // vor dem Snapshot zurücksetzen: ein Event währenddessen markiert erneut
+  uint8_t groups = liveFull ? (uint8_t)LIVE_ALL : liveDirty;
+  liveDirty = 0;
+  liveFull = false;
+  lastPushMs = now;
+  ws.textAll(liveJson(groups));
+}
+
+void webui_setup(AsyncWebServer& server) {
+  for (uint8_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset& a = WEB_ASSETS[i];
+    server.on(a.path, HTTP_GET, [&a](AsyncWebServerRequest* req) { handleAsset(req, a); });
+  }
+  server.on("/api/cmd", HTTP_POST, handleCmd, nullptr, collectBody);
+  server.on("/api/state", HTTP_GET, handleState);
+  server.on("/api/telemetry", HTTP_GET, handleTelemetry);
+  server.on("/api/metrics", HTTP_GET, handleMetrics);
+  server.on("/api/fb", HTTP_GET, handleFramebuffer);
+  server.on("/api/wifi", HTTP_POST, handleWifiSave, nullptr, collectBody);
+  server.on("/api/reboot", HTTP_POST, handleReboot);
+
+  ws.onEvent(onWsEvent);
+  server.addHandler(&ws);
 
   server.begin();
-  Serial.println("HTTP server started.");
+  Serial.println("HTTP server started (async, WebSocket /ws).");
 }
 
-void webui_loop(WebServer& server) {
-  server.handleClient();
+void webui_loop() {
+  runPendingCmds();
+  pushLive();
+
+  uint32_t now = millis();
+  if (now - lastPingMs >= WEB_WS_PING_MS) {
+    lastPingMs = now;
+    ws.pingAll();            // hält die Verbindung über AP/NAT offen
+    ws.cleanupClients(WEB_WS_MAX_CLIENTS);
+  }
+  if (rebootAtMs && (int32_t)(now - rebootAtMs) >= 0) ESP.restart();
 }
@@ -1,6 +1,8 @@
 #pragma once
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include "config.h"
 
-void webui_setup(WebServer& server);
-void webui_loop(WebServer& server);
\ No newline at end of file
+// Routen und WebSocket am Server registrieren und starten
+void webui_setup(AsyncWebServer& server);
+// aus loop(): Befehle der Web-Clients ausführen, Live-Status pushen
+void webui_loop();